@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Utils/StringExt.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class Stopwatch
+		{
+		public:
+			using clock_t = std::chrono::steady_clock;
+
+			Stopwatch()
+				: _start(clock_t::now())
+			{ }
+
+			void Restart()
+			{
+				_start = clock_t::now();
+			}
+
+			double GetElapsedNanoseconds() const
+			{
+				return std::chrono::duration<double, std::nano>(clock_t::now() - _start).count();
+			}
+
+		private:
+			clock_t::time_point _start;
+		};
+
+		// Prevents the optimizer from discarding a computed value
+		template<typename value_t>
+		void KeepAlive(const value_t& value)
+		{
+			static_assert(std::is_trivially_copyable_v<value_t>, "Value must be trivially copyable");
+			static volatile unsigned char sink;
+			const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+			for (size_t i = 0; i < sizeof(value_t); ++i)
+			{
+				sink = sink ^ bytes[i];
+			}
+		}
+
+		template<typename func_t>
+		double MeasureNanosecondsPerIteration(uint64_t iterations, func_t func)
+		{
+			// Warm up caches and branch predictors before measuring
+			for (uint64_t i = 0; i < iterations / 10 + 1; ++i)
+			{
+				func();
+			}
+
+			Stopwatch stopwatch;
+			for (uint64_t i = 0; i < iterations; ++i)
+			{
+				func();
+			}
+			return stopwatch.GetElapsedNanoseconds() / static_cast<double>(iterations);
+		}
+
+		template<typename stream_t>
+		void WriteHeader(stream_t& output, const std::string& title)
+		{
+			output << std::endl << "== " << title << " ==" << std::endl;
+		}
+
+		template<typename stream_t>
+		void WriteResult(stream_t& output, const std::string& name, double nanoseconds, const std::string& unit = "op")
+		{
+			output << StringExt::Format<std::string>("  %-48s %14.2f ns/%s", name.c_str(), nanoseconds, unit.c_str()) << std::endl;
+		}
+	}
+}
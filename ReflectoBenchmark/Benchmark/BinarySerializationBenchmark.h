@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Reader/BinarySerializationReader.h"
+#include "Serialization/Reader/CborSerializationReader.h"
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+#include "Serialization/Reader/MsgPackSerializationReader.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/BinarySerializationWriter.h"
+#include "Serialization/Writer/CborSerializationWriter.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+#include "Utils/StringExt.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class BinarySerializationBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Binary serialization (JSON vs binary with names or indexes vs MessagePack vs CBOR)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.Add<double>("double")
+					.Add<std::string>("string")
+					.Add<std::vector<std::string>>("vector<string>")
+					.BeginType<Record>("Record")
+						.RegisterMember(&Record::Id, "Id")
+						.RegisterMember(&Record::Name, "Name")
+						.RegisterMember(&Record::Weight, "Weight")
+						.RegisterMember(&Record::Tags, "Tags")
+					.EndType<Record>()
+					.Add<std::vector<Record>>("vector<Record>")
+				.Build();
+
+				const Serialization::Serializer serializer = Serialization::SerializerFactory(library)
+					.LearnType<int32_t, Serialization::Int32SerializationStrategy>()
+					.LearnType<double, Serialization::DoubleSerializationStrategy>()
+					.LearnType<std::string, Serialization::StringSerializationStrategy>()
+					.LearnType<std::vector<std::string>, Serialization::VectorSerializationStrategy<std::vector<std::string>>>()
+					.LearnType<Record, Serialization::ObjectSerializationStrategy<Record>>()
+					.LearnType<std::vector<Record>, Serialization::VectorSerializationStrategy<std::vector<Record>>>()
+					.SetFormat(Serialization::SerializationFormat::Short)
+				.Build();
+
+				std::vector<Record> records(kRecordCount);
+				for (uint32_t i = 0; i < kRecordCount; ++i)
+				{
+					records[i].Id = i;
+					records[i].Name = StringExt::Format<std::string>("Record%u", i);
+					records[i].Weight = i * 0.25;
+					records[i].Tags = { "red", "large" };
+				}
+
+				Run<Serialization::JsonStreamSerializationWriter, Serialization::JsonStreamSerializationReader>(output, "JSON", serializer, records);
+				Run<Serialization::BinarySerializationWriter, Serialization::BinarySerializationReader>(output, "binary names", serializer, records, Serialization::BinaryPropertyFormat::Name);
+				Run<Serialization::BinarySerializationWriter, Serialization::BinarySerializationReader>(output, "binary indexes", serializer, records, Serialization::BinaryPropertyFormat::Index);
+				Run<Serialization::MsgPackSerializationWriter, Serialization::MsgPackSerializationReader>(output, "MessagePack", serializer, records);
+				Run<Serialization::CborSerializationWriter, Serialization::CborSerializationReader>(output, "CBOR", serializer, records);
+			}
+
+		private:
+			struct Record
+			{
+				int32_t Id = 0;
+				std::string Name;
+				double Weight = 0;
+				std::vector<std::string> Tags;
+			};
+
+			template<typename writer_t, typename reader_t, typename stream_t, typename... args_t>
+			void Run(stream_t& output, const std::string& name, const Serialization::Serializer& serializer, const std::vector<Record>& records, args_t... args)
+			{
+				writer_t writer(args...);
+				const double serialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					serializer.Serialize(records, writer);
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				const std::string buffer = writer.GetBuffer();
+				const double deserialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					reader_t reader(args...);
+					reader.Import(std::string_view(buffer));
+					std::vector<Record> deserialized;
+					serializer.Deserialize(deserialized, reader);
+					KeepAlive(deserialized.size());
+				});
+
+				WriteResult(output, name + " serialize", serialize / kRecordCount, "record");
+				WriteResult(output, name + " deserialize", deserialize / kRecordCount, "record");
+				output << StringExt::Format<std::string>("  %-48s %14.2f bytes/record", (name + " size").c_str(), static_cast<double>(buffer.size()) / kRecordCount) << std::endl;
+			}
+
+			static constexpr uint32_t kRecordCount = 10000;
+			static constexpr uint64_t kIterations = 20;
+		};
+	}
+}
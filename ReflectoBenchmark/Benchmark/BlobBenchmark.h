@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Base64Encoding.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+
+#include <cstdint>
+#include <string>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class BlobBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Blobs (array of numbers vs base64)");
+
+				std::string bytes(kByteCount, '\0');
+				for (uint32_t i = 0; i < kByteCount; ++i)
+				{
+					bytes[i] = static_cast<char>(i * 131 + (i >> 3));
+				}
+
+				// What a byte vector gives without a blob: one number per byte
+				Serialization::JsonStreamSerializationWriter writer;
+				const double numberWrite = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					writer.WriteBeginArray();
+					for (const char byte : bytes)
+					{
+						writer.WriteBeginArrayElement();
+						writer.WriteUnsignedInteger32(static_cast<uint8_t>(byte));
+						writer.WriteEndArrayElement();
+					}
+					writer.WriteEndArray();
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				const double blobWrite = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					writer.WriteBytes(bytes);
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				WriteResult(output, "JSON write as numbers", numberWrite / kByteCount, "byte");
+				WriteResult(output, "JSON write as base64", blobWrite / kByteCount, "byte");
+
+				Run(output, "Scalar", Serialization::Base64Encoding::Implementation::Scalar, bytes);
+				Run(output, "AVX2", Serialization::Base64Encoding::Implementation::Avx2, bytes);
+			}
+
+		private:
+			template<typename stream_t>
+			void Run(stream_t& output, const std::string& name, Serialization::Base64Encoding::Implementation implementation, const std::string& bytes)
+			{
+				if (Serialization::Base64Encoding::IsSupported(implementation))
+				{
+					std::string text;
+					const double encode = MeasureNanosecondsPerIteration(kIterations, [&] {
+						text.clear();
+						Serialization::Base64Encoding::Encode(bytes, text, implementation);
+						KeepAlive(text.size());
+					});
+
+					std::string decoded;
+					const double decode = MeasureNanosecondsPerIteration(kIterations, [&] {
+						Serialization::Base64Encoding::Decode(text, decoded, implementation);
+						KeepAlive(decoded.size());
+					});
+
+					WriteResult(output, name + " base64 encode", encode / kByteCount, "byte");
+					WriteResult(output, name + " base64 decode", decode / kByteCount, "byte");
+				}
+			}
+
+			static constexpr uint32_t kByteCount = 64 * 1024;
+			static constexpr uint64_t kIterations = 200;
+		};
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/ConstructorDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <any>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class ConstructionBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Reflected object churn (heap vs arena vs pool)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.Add<std::string>("string")
+					.BeginType<Record>("Record")
+						.RegisterMember(&Record::Id, "Id")
+						.RegisterMember(&Record::Name, "Name")
+					.EndType<Record>()
+				.Build();
+
+				const Reflection::ConstructorDescriptor& constructor = *library.FindDescriptor<Record>()->GetConstructor();
+
+				const double weak = MeasureNanosecondsPerIteration(kIterations, [&] {
+					std::unique_ptr<std::any> instance = constructor.NewWeakInstance();
+					KeepAlive(instance.get());
+				});
+
+				const double heap = MeasureNanosecondsPerIteration(kIterations, [&] {
+					void* instance = constructor.New(*std::pmr::new_delete_resource());
+					KeepAlive(instance);
+					constructor.Delete(*std::pmr::new_delete_resource(), instance);
+				});
+
+				// Batches of objects built in an arena and released together
+				std::pmr::monotonic_buffer_resource arena(kBatchSize * sizeof(Record) * 2);
+				const double arenaBatch = MeasureNanosecondsPerIteration(kIterations / kBatchSize, [&] {
+					for (uint32_t i = 0; i < kBatchSize; ++i)
+					{
+						void* instance = constructor.New(arena);
+						KeepAlive(instance);
+						constructor.Destroy(instance);
+					}
+					arena.release();
+				}) / kBatchSize;
+
+				std::pmr::unsynchronized_pool_resource pool;
+				const double pooled = MeasureNanosecondsPerIteration(kIterations, [&] {
+					void* instance = constructor.New(pool);
+					KeepAlive(instance);
+					constructor.Delete(pool, instance);
+				});
+
+				WriteResult(output, "NewWeakInstance (unique_ptr<any>)", weak, "object");
+				WriteResult(output, "New/Delete new_delete_resource", heap, "object");
+				WriteResult(output, "New in monotonic arena", arenaBatch, "object");
+				WriteResult(output, "New/Delete unsynchronized pool", pooled, "object");
+			}
+
+		private:
+			struct Record
+			{
+				int32_t Id = 0;
+				std::string Name;
+			};
+
+			static constexpr uint64_t kIterations = 4000000;
+			static constexpr uint32_t kBatchSize = 1000;
+		};
+	}
+}
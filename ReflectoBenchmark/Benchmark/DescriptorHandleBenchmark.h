@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+#include "Utils/StringExt.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class DescriptorHandleBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Descriptor handles across threads (owning vs borrowed)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.Add<float>("float")
+					.Add<bool>("boolean")
+					.Add<std::string>("string")
+					.BeginType<Person>("Person")
+						.RegisterMember(&Person::Name, "Name")
+						.RegisterMember(&Person::Age, "Age")
+						.RegisterMember(&Person::Height, "Height")
+						.RegisterMember(&Person::Active, "Active")
+					.EndType<Person>()
+				.Build();
+
+				const uint32_t maxThreadCount = std::max(1u, std::thread::hardware_concurrency());
+				for (uint32_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+				{
+					// Shared pointer copies for the type and each of its member types
+					const double owning = MeasureParallel(threadCount, [&] {
+						const Reflection::TypeDescriptorPtr type = library.GetDescriptor<Person>();
+						uintptr_t checksum = reinterpret_cast<uintptr_t>(type.get());
+						for (const Reflection::MemberDescriptor& member : type->GetMembers())
+						{
+							const Reflection::TypeDescriptorPtr memberType = library.GetDescriptorByHash(member.GetTypeHash());
+							checksum ^= reinterpret_cast<uintptr_t>(memberType.get());
+						}
+						return checksum;
+					});
+
+					const double borrowed = MeasureParallel(threadCount, [&] {
+						const Reflection::TypeDescriptor* type = library.FindDescriptor<Person>();
+						uintptr_t checksum = reinterpret_cast<uintptr_t>(type);
+						for (const Reflection::MemberDescriptor& member : type->GetMembers())
+						{
+							checksum ^= reinterpret_cast<uintptr_t>(member.GetType());
+						}
+						return checksum;
+					});
+
+					WriteResult(output, StringExt::Format<std::string>("%u threads, owning", threadCount), owning, "walk");
+					WriteResult(output, StringExt::Format<std::string>("%u threads, borrowed", threadCount), borrowed, "walk");
+				}
+			}
+
+		private:
+			struct Person
+			{
+				std::string Name;
+				int32_t Age = 0;
+				float Height = 0;
+				bool Active = false;
+			};
+
+			// Runs func on every thread at once and returns the per thread cost of one call.
+			// Flat numbers as threads are added mean the work scales.
+			template<typename func_t>
+			static double MeasureParallel(uint32_t threadCount, func_t func)
+			{
+				std::atomic<uint32_t> ready = 0;
+				std::atomic<bool> start = false;
+				std::vector<double> nanoseconds(threadCount);
+				std::vector<std::thread> threads;
+				threads.reserve(threadCount);
+				for (uint32_t i = 0; i < threadCount; ++i)
+				{
+					threads.emplace_back([&, i] {
+						++ready;
+						while (!start)
+						{
+							std::this_thread::yield();
+						}
+
+						// Accumulate locally, a shared sink would itself bounce between cores
+						uintptr_t checksum = 0;
+						Stopwatch stopwatch;
+						for (uint64_t iteration = 0; iteration < kIterationsPerThread; ++iteration)
+						{
+							checksum += func();
+						}
+						nanoseconds[i] = stopwatch.GetElapsedNanoseconds() / kIterationsPerThread;
+						KeepAlive(checksum);
+					});
+				}
+
+				while (ready != threadCount)
+				{
+					std::this_thread::yield();
+				}
+				start = true;
+
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				return *std::max_element(nanoseconds.begin(), nanoseconds.end());
+			}
+
+			static constexpr uint64_t kIterationsPerThread = 2000000;
+		};
+	}
+}
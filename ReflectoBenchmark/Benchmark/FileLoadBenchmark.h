@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Reader/JsonSerializationReader.h"
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Utils/IOExt.h"
+#include "Utils/StringExt.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class FileLoadBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Large JSON file loading (stream vs bulk read vs memory map)");
+
+				const std::string file = (std::filesystem::temp_directory_path() / "ReflectoFileLoadBenchmark.json").string();
+				const std::string json = BuildSnapshot();
+				IOExt::WriteToFile(file, std::vector<char>(json.begin(), json.end()));
+				const double megabytes = json.size() / (1024.0 * 1024.0);
+
+				const double characterRead = MeasureNanosecondsPerIteration(kIterations, [&] {
+					std::ifstream fileReader(file, std::ios::in | std::ios::binary);
+					fileReader.unsetf(std::ios::skipws);
+					std::vector<char> bytes;
+					std::copy(std::istream_iterator<char>(fileReader), std::istream_iterator<char>(), std::back_inserter(bytes));
+					KeepAlive(bytes.size());
+				});
+
+				const double bulkRead = MeasureNanosecondsPerIteration(kIterations, [&] {
+					std::string content;
+					IOExt::ReadFromFile(file, content);
+					KeepAlive(content.size());
+				});
+
+				const double mapped = MeasureNanosecondsPerIteration(kIterations, [&] {
+					IOExt::MappedFile mappedFile;
+					IOExt::MapFile(file, mappedFile);
+					KeepAlive(Checksum(mappedFile.GetView()));
+				});
+
+				const double documentParse = MeasureNanosecondsPerIteration(kIterations, [&] {
+					std::ifstream fileReader(file, std::ios::in | std::ios::binary);
+					Serialization::JsonSerializationReader reader;
+					reader.Import(fileReader);
+					KeepAlive(ReadSnapshot(reader));
+				});
+
+				const double mappedParse = MeasureNanosecondsPerIteration(kIterations, [&] {
+					Serialization::JsonStreamSerializationReader reader;
+					reader.ImportFile(file);
+					KeepAlive(ReadSnapshot(reader));
+				});
+
+				std::remove(file.c_str());
+
+				WriteResult(output, "istream_iterator read", characterRead / megabytes, "MB");
+				WriteResult(output, "IOExt::ReadFromFile bulk read", bulkRead / megabytes, "MB");
+				WriteResult(output, "IOExt::MapFile and touch every page", mapped / megabytes, "MB");
+				WriteResult(output, "istream to JsonSerializationReader", documentParse / megabytes, "MB");
+				WriteResult(output, "mapped JsonStreamSerializationReader views", mappedParse / megabytes, "MB");
+			}
+
+		private:
+			static std::string BuildSnapshot()
+			{
+				Serialization::JsonStreamSerializationWriter writer;
+				writer.WriteBeginArray();
+				for (uint32_t i = 0; i < kRecordCount; ++i)
+				{
+					writer.WriteBeginArrayElement();
+					writer.WriteBeginObject();
+					{
+						writer.WriteBeginObjectProperty("Id");
+						writer.WriteInteger32(i);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Name");
+						writer.WriteString(StringExt::Format<std::string>("Record name number %u", i));
+						writer.WriteEndObjectProperty();
+					}
+					writer.WriteEndObject();
+					writer.WriteEndArrayElement();
+				}
+				writer.WriteEndArray();
+				return writer.GetBuffer();
+			}
+
+			template<typename reader_t>
+			static uint64_t ReadSnapshot(reader_t& reader)
+			{
+				uint64_t checksum = 0;
+				uint32_t index;
+				reader.ReadBeginArray();
+				while (reader.HasArrayElementRemaining())
+				{
+					reader.ReadBeginArrayElement(index);
+					reader.ReadBeginObject();
+					while (reader.HasObjectPropertyRemaining())
+					{
+						std::string property;
+						int32_t id;
+						reader.ReadBeginObjectProperty(property);
+						if (property == "Id")
+						{
+							reader.ReadInteger32(id);
+							checksum += id;
+						}
+						else
+						{
+							checksum += ReadName(reader);
+						}
+						reader.ReadEndObjectProperty();
+					}
+					reader.ReadEndObject();
+					reader.ReadEndArrayElement();
+				}
+				reader.ReadEndArray();
+				return checksum;
+			}
+
+			static size_t ReadName(Serialization::JsonSerializationReader& reader)
+			{
+				std::string name;
+				reader.ReadString(name);
+				return name.size();
+			}
+
+			static size_t ReadName(Serialization::JsonStreamSerializationReader& reader)
+			{
+				std::string_view name;
+				reader.ReadStringView(name);
+				return name.size();
+			}
+
+			// Reads a byte per page so that the whole mapping is faulted in
+			static uint64_t Checksum(std::string_view content)
+			{
+				uint64_t checksum = 0;
+				for (size_t i = 0; i < content.size(); i += 4096)
+				{
+					checksum += static_cast<uint8_t>(content[i]);
+				}
+				return checksum;
+			}
+
+			static constexpr uint32_t kRecordCount = 500000;
+			static constexpr uint64_t kIterations = 3;
+		};
+	}
+}
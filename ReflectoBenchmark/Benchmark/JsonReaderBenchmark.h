@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/Reader/JsonSerializationReader.h"
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Utils/StringExt.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class JsonReaderBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "JSON reader (document vs streaming)");
+
+				Run(output, "wide", BuildWide(), &ReadWide);
+				Run(output, "deep", BuildDeep(), &ReadDeep);
+				Run(output, "integers", BuildIntegers(), &ReadIntegers);
+			}
+
+		private:
+			using ISerializationReader = Serialization::ISerializationReader;
+
+			template<typename stream_t>
+			void Run(stream_t& output, const std::string& name, const std::string& json, bool(*read)(ISerializationReader&))
+			{
+				const double document = MeasureNanosecondsPerIteration(kIterations, [&] {
+					Serialization::JsonSerializationReader reader;
+					std::istringstream stream(json);
+					reader.Import(stream);
+					KeepAlive(read(reader));
+				});
+
+				const double streaming = MeasureNanosecondsPerIteration(kIterations, [&] {
+					Serialization::JsonStreamSerializationReader reader;
+					reader.Import(std::string_view(json));
+					KeepAlive(read(reader));
+				});
+
+				WriteResult(output, name + " JsonSerializationReader", document, "document");
+				WriteResult(output, name + " JsonStreamSerializationReader", streaming, "document");
+			}
+
+			static std::string BuildWide()
+			{
+				Serialization::JsonStreamSerializationWriter writer;
+				writer.WriteBeginObject();
+				for (uint32_t i = 0; i < kWideCount; ++i)
+				{
+					writer.WriteBeginObjectProperty(StringExt::Format<std::string>("Property%04u", i));
+					writer.WriteBeginObject();
+					{
+						writer.WriteBeginObjectProperty("Id");
+						writer.WriteInteger32(i);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Name");
+						writer.WriteString(StringExt::Format<std::string>("Name%u", i));
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Weight");
+						writer.WriteDouble(i * 0.5);
+						writer.WriteEndObjectProperty();
+					}
+					writer.WriteEndObject();
+					writer.WriteEndObjectProperty();
+				}
+				writer.WriteEndObject();
+				return writer.GetBuffer();
+			}
+
+			static std::string BuildDeep()
+			{
+				std::string json;
+				for (uint32_t depth = kDeepCount; depth > 0; --depth)
+				{
+					json += StringExt::Format<std::string>(R"({"Depth":%u,"Next":)", depth);
+				}
+				json += R"({"Depth":0})";
+				json.append(kDeepCount, '}');
+				return json;
+			}
+
+			// Array of 64 bits identifiers, mostly of 16 to 19 digits
+			static std::string BuildIntegers()
+			{
+				Serialization::JsonStreamSerializationWriter writer;
+				writer.WriteBeginArray();
+				uint64_t id = 88172645463325252ull;
+				for (uint32_t i = 0; i < kIntegerCount; ++i)
+				{
+					id ^= id << 13;
+					id ^= id >> 7;
+					id ^= id << 17;
+					writer.WriteBeginArrayElement();
+					writer.WriteInteger64(static_cast<int64_t>(id >> 1));
+					writer.WriteEndArrayElement();
+				}
+				writer.WriteEndArray();
+				return writer.GetBuffer();
+			}
+
+			static bool ReadWide(ISerializationReader& reader)
+			{
+				bool success = reader.ReadBeginObject();
+				while (success && reader.HasObjectPropertyRemaining())
+				{
+					std::string property;
+					success &= reader.ReadBeginObjectProperty(property);
+					success &= reader.ReadBeginObject();
+					while (success && reader.HasObjectPropertyRemaining())
+					{
+						int32_t id;
+						std::string name;
+						double weight;
+						success &= reader.ReadBeginObjectProperty(property);
+						success &= property == "Id" ? reader.ReadInteger32(id) : property == "Name" ? reader.ReadString(name) : reader.ReadDouble(weight);
+						success &= reader.ReadEndObjectProperty();
+					}
+					success &= reader.ReadEndObject();
+					success &= reader.ReadEndObjectProperty();
+				}
+				success &= reader.ReadEndObject();
+				return success;
+			}
+
+			static bool ReadDeep(ISerializationReader& reader)
+			{
+				bool success = reader.ReadBeginObject();
+				while (success && reader.HasObjectPropertyRemaining())
+				{
+					std::string property;
+					int32_t depth;
+					success &= reader.ReadBeginObjectProperty(property);
+					success &= property == "Depth" ? reader.ReadInteger32(depth) : ReadDeep(reader);
+					success &= reader.ReadEndObjectProperty();
+				}
+				success &= reader.ReadEndObject();
+				return success;
+			}
+
+			static bool ReadIntegers(ISerializationReader& reader)
+			{
+				bool success = reader.ReadBeginArray();
+				while (success && reader.HasArrayElementRemaining())
+				{
+					uint32_t index;
+					int64_t id;
+					success &= reader.ReadBeginArrayElement(index);
+					success &= reader.ReadInteger64(id);
+					success &= reader.ReadEndArrayElement();
+				}
+				success &= reader.ReadEndArray();
+				return success;
+			}
+
+			static constexpr uint32_t kWideCount = 1000;
+			static constexpr uint32_t kDeepCount = 200;
+			static constexpr uint32_t kIntegerCount = 10000;
+			static constexpr uint64_t kIterations = 100;
+		};
+	}
+}
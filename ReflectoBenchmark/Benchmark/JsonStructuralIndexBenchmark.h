@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/Reader/JsonIndexedSerializationReader.h"
+#include "Serialization/Reader/JsonSerializationReader.h"
+#include "Serialization/Reader/JsonStructuralIndex.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Utils/StringExt.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class JsonStructuralIndexBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "JSON structural index (scalar vs SSE2 vs AVX2, document vs indexed reader)");
+
+				Run(output, "1 KB", 1024);
+				Run(output, "1 MB", 1024 * 1024);
+				Run(output, "100 MB", 100 * 1024 * 1024);
+			}
+
+		private:
+			using Implementation = Serialization::JsonStructuralIndex::Implementation;
+			using ISerializationReader = Serialization::ISerializationReader;
+
+			template<typename stream_t>
+			void Run(stream_t& output, const std::string& name, size_t size)
+			{
+				const std::string json = BuildRecords(size);
+				const double megabytes = json.size() / (1024.0 * 1024.0);
+				// Roughly the same amount of bytes is processed at every size
+				const uint64_t iterations = std::max<uint64_t>(1, kBytesPerMeasure / json.size());
+
+				const std::pair<Implementation, const char*> implementations[] = {
+					{ Implementation::Scalar, "scalar" },
+					{ Implementation::Sse2, "SSE2" },
+					{ Implementation::Avx2, "AVX2" }
+				};
+				for (const auto& [implementation, implementationName] : implementations)
+				{
+					if (Serialization::JsonStructuralIndex::IsSupported(implementation))
+					{
+						Serialization::JsonStructuralIndex index;
+						const double indexing = MeasureNanosecondsPerIteration(iterations, [&] {
+							index.Build(json, implementation);
+							KeepAlive(index.GetPositions().size());
+						});
+						WriteResult(output, StringExt::Format<std::string>("%s %s index", name.c_str(), implementationName), indexing / megabytes, "MB");
+					}
+				}
+
+				const double document = MeasureNanosecondsPerIteration(iterations, [&] {
+					Serialization::JsonSerializationReader reader;
+					std::istringstream stream(json);
+					reader.Import(stream);
+					KeepAlive(ReadRecords(reader));
+				});
+
+				const double indexed = MeasureNanosecondsPerIteration(iterations, [&] {
+					Serialization::JsonIndexedSerializationReader reader;
+					reader.Import(std::string_view(json));
+					KeepAlive(ReadRecords(reader));
+				});
+
+				WriteResult(output, name + " JsonSerializationReader", document / megabytes, "MB");
+				WriteResult(output, name + " JsonIndexedSerializationReader", indexed / megabytes, "MB");
+			}
+
+			static std::string BuildRecords(size_t size)
+			{
+				Serialization::JsonStreamSerializationWriter writer;
+				writer.Reserve(size + 256);
+				writer.WriteBeginArray();
+				for (uint32_t i = 0; writer.GetBuffer().size() < size; ++i)
+				{
+					writer.WriteBeginArrayElement();
+					writer.WriteBeginObject();
+					{
+						writer.WriteBeginObjectProperty("Id");
+						writer.WriteInteger32(i);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Name");
+						writer.WriteString(StringExt::Format<std::string>("Record \"%u\" of the benchmark", i));
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Weight");
+						writer.WriteDouble(i * 0.25);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Active");
+						writer.WriteBoolean(i % 2 == 0);
+						writer.WriteEndObjectProperty();
+					}
+					writer.WriteEndObject();
+					writer.WriteEndArrayElement();
+				}
+				writer.WriteEndArray();
+				return writer.GetBuffer();
+			}
+
+			static uint64_t ReadRecords(ISerializationReader& reader)
+			{
+				uint64_t checksum = 0;
+				uint32_t index;
+				bool success = reader.ReadBeginArray();
+				while (success && reader.HasArrayElementRemaining())
+				{
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadBeginObject();
+					while (success && reader.HasObjectPropertyRemaining())
+					{
+						std::string property;
+						int32_t id = 0;
+						std::string name;
+						double weight = 0;
+						bool active = false;
+						success &= reader.ReadBeginObjectProperty(property);
+						if (property == "Id")
+						{
+							success &= reader.ReadInteger32(id);
+						}
+						else if (property == "Name")
+						{
+							success &= reader.ReadString(name);
+						}
+						else if (property == "Weight")
+						{
+							success &= reader.ReadDouble(weight);
+						}
+						else
+						{
+							success &= reader.ReadBoolean(active);
+						}
+						success &= reader.ReadEndObjectProperty();
+						checksum += id + name.size() + static_cast<uint64_t>(weight) + active;
+					}
+					success &= reader.ReadEndObject() && reader.ReadEndArrayElement();
+				}
+				success &= reader.ReadEndArray();
+				return success ? checksum : 0;
+			}
+
+			static constexpr uint64_t kBytesPerMeasure = 100 * 1024 * 1024;
+		};
+	}
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Writer/ISerializationWriter.h"
+#include "Serialization/Writer/JsonSerializationWriter.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Utils/StringExt.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class JsonWriterBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "JSON writer (document vs streaming)");
+
+				std::vector<std::string> names(kWideCount);
+				for (uint32_t i = 0; i < kWideCount; ++i)
+				{
+					names[i] = StringExt::Format<std::string>("Property%04u", i);
+				}
+
+				Run(output, "wide", [&](ISerializationWriter& writer) { WriteWide(writer, names); });
+				Run(output, "deep", [&](ISerializationWriter& writer) { WriteDeep(writer, kDeepCount); });
+				Run(output, "floats", [&](ISerializationWriter& writer) { WriteFloats(writer, kFloatCount); });
+			}
+
+		private:
+			template<typename stream_t, typename write_t>
+			void Run(stream_t& output, const std::string& name, const write_t& write)
+			{
+				const double document = MeasureNanosecondsPerIteration(kIterations, [&] {
+					Serialization::JsonSerializationWriter writer;
+					write(writer);
+					std::ostringstream stream;
+					writer.Export(stream);
+					KeepAlive(stream.tellp());
+				});
+
+				Serialization::JsonStreamSerializationWriter streamWriter;
+				const double streaming = MeasureNanosecondsPerIteration(kIterations, [&] {
+					streamWriter.Clear();
+					write(streamWriter);
+					std::ostringstream stream;
+					streamWriter.Export(stream);
+					KeepAlive(stream.tellp());
+				});
+
+				WriteResult(output, name + " JsonSerializationWriter", document, "document");
+				WriteResult(output, name + " JsonStreamSerializationWriter", streaming, "document");
+			}
+
+			// One object of many small objects
+			static void WriteWide(ISerializationWriter& writer, const std::vector<std::string>& names)
+			{
+				writer.WriteBeginObject();
+				for (uint32_t i = 0; i < names.size(); ++i)
+				{
+					writer.WriteBeginObjectProperty(names[i]);
+					writer.WriteBeginObject();
+					{
+						writer.WriteBeginObjectProperty("Id");
+						writer.WriteInteger32(i);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Name");
+						writer.WriteString(names[i]);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Weight");
+						writer.WriteDouble(i * 0.5);
+						writer.WriteEndObjectProperty();
+					}
+					writer.WriteEndObject();
+					writer.WriteEndObjectProperty();
+				}
+				writer.WriteEndObject();
+			}
+
+			// Objects nested depth times, each with a value next to the nested object
+			static void WriteDeep(ISerializationWriter& writer, uint32_t depth)
+			{
+				writer.WriteBeginObject();
+				writer.WriteBeginObjectProperty("Depth");
+				writer.WriteInteger32(depth);
+				writer.WriteEndObjectProperty();
+				if (depth > 0)
+				{
+					writer.WriteBeginObjectProperty("Next");
+					WriteDeep(writer, depth - 1);
+					writer.WriteEndObjectProperty();
+				}
+				writer.WriteEndObject();
+			}
+
+			// Array of points, mostly floats and doubles
+			static void WriteFloats(ISerializationWriter& writer, uint32_t count)
+			{
+				writer.WriteBeginArray();
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					writer.WriteBeginArrayElement();
+					writer.WriteBeginObject();
+					{
+						writer.WriteBeginObjectProperty("X");
+						writer.WriteFloat(i * 0.1f);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Y");
+						writer.WriteFloat(i * -2.75f + 0.3f);
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Z");
+						writer.WriteFloat(1.0f / (i + 1));
+						writer.WriteEndObjectProperty();
+
+						writer.WriteBeginObjectProperty("Time");
+						writer.WriteDouble(i / 60.0);
+						writer.WriteEndObjectProperty();
+					}
+					writer.WriteEndObject();
+					writer.WriteEndArrayElement();
+				}
+				writer.WriteEndArray();
+			}
+
+			static constexpr uint32_t kWideCount = 1000;
+			static constexpr uint32_t kDeepCount = 200;
+			static constexpr uint32_t kFloatCount = 1000;
+			static constexpr uint64_t kIterations = 200;
+		};
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/MethodDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <any>
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class MethodInvocationBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Method invocation (direct vs reflected)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.BeginType<Accumulator>("Accumulator")
+						.RegisterMethod(&Accumulator::Add, "Add", { "left", "right" })
+					.EndType<Accumulator>()
+				.Build();
+
+				const Reflection::MethodDescriptor* method = library.FindDescriptor<Accumulator>()->GetMethodByName("Add");
+				Accumulator accumulator;
+				int32_t left = 1;
+				int32_t right = 2;
+
+				// Member function pointer called through a volatile, so the direct call is not folded away
+				int32_t(Accumulator::* volatile methodPointer)(int32_t, int32_t) = &Accumulator::Add;
+				const double direct = MeasureNanosecondsPerIteration(kIterations, [&] {
+					KeepAlive((accumulator.*methodPointer)(left, right));
+				});
+
+				const double thunk = MeasureNanosecondsPerIteration(kIterations, [&] {
+					int32_t result = 0;
+					void* args[] = { &left, &right };
+					method->Invoke(&accumulator, args, &result);
+					KeepAlive(result);
+				});
+
+				const Reflection::MethodDescriptor::weak_method_ptr_t<Accumulator, 2> weakMethod = method->GetWeakMethod<Accumulator, 2>();
+				const double weak = MeasureNanosecondsPerIteration(kIterations, [&] {
+					const Reflection::MethodDescriptor::weak_method_params_t<2> args = { left, right };
+					const std::any result = weakMethod(&accumulator, args);
+					KeepAlive(std::any_cast<int32_t>(result));
+				});
+
+				WriteResult(output, "direct call", direct, "call");
+				WriteResult(output, "invoker thunk", thunk, "call");
+				WriteResult(output, "std::function and std::any", weak, "call");
+			}
+
+		private:
+			struct Accumulator
+			{
+				int32_t Add(int32_t left, int32_t right)
+				{
+					Total += left + right;
+					return Total;
+				}
+
+				int32_t Total = 0;
+			};
+
+			static constexpr uint64_t kIterations = 20000000;
+		};
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Writer/BinarySerializationWriter.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class NumberArrayBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Number arrays (one element at a time vs whole array)");
+
+				// Telemetry frame of float samples
+				std::vector<float> samples(kSampleCount);
+				for (uint32_t i = 0; i < kSampleCount; ++i)
+				{
+					samples[i] = i * 0.125f - 100.0f;
+				}
+
+				Run<Serialization::BinarySerializationWriter>(output, "Binary", samples);
+				Run<Serialization::MsgPackSerializationWriter>(output, "MessagePack", samples);
+				Run<Serialization::JsonStreamSerializationWriter>(output, "JSON", samples);
+			}
+
+		private:
+			template<typename writer_t, typename stream_t>
+			void Run(stream_t& output, const std::string& name, const std::vector<float>& samples)
+			{
+				writer_t writer;
+				const double elementWrite = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					writer.ISerializationWriter::WriteFloatArray(samples.data(), samples.size());
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				const double arrayWrite = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					writer.WriteFloatArray(samples.data(), samples.size());
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				WriteResult(output, name + " per element", elementWrite / kSampleCount, "float");
+				WriteResult(output, name + " whole array", arrayWrite / kSampleCount, "float");
+			}
+
+			static constexpr uint32_t kSampleCount = 4096;
+			static constexpr uint64_t kIterations = 2000;
+		};
+	}
+}
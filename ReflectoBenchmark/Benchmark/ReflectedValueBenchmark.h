@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/ReflectedValue.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class ReflectedValueBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Reflected value construction (std::any vs ReflectedValue)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.Add<std::string>("string")
+					.BeginType<Large>("Large")
+						.RegisterMember(&Large::Last, "Last")
+					.EndType<Large>()
+				.Build();
+
+				Run(output, "int32", library.FindDescriptor<int32_t>());
+				Run(output, "Large", library.FindDescriptor<Large>());
+			}
+
+		private:
+			struct Large
+			{
+				int32_t Values[256] = {};
+				int32_t Last = 0;
+			};
+
+			template<typename stream_t>
+			void Run(stream_t& output, const std::string& name, const Reflection::TypeDescriptor* type)
+			{
+				const Reflection::ConstructorDescriptor& constructor = *type->GetConstructor();
+
+				// Previous deserialization path: construct through unique_ptr<any>, then copy out
+				const double any = MeasureNanosecondsPerIteration(kIterations, [&] {
+					std::any value = *constructor.NewWeakInstance();
+					KeepAlive(value.has_value());
+				});
+
+				const double reflected = MeasureNanosecondsPerIteration(kIterations, [&] {
+					Reflection::ReflectedValue value(type);
+					KeepAlive(value.GetAddress());
+				});
+
+				WriteResult(output, name + " std::any", any, "value");
+				WriteResult(output, name + " ReflectedValue", reflected, "value");
+			}
+
+			static constexpr uint64_t kIterations = 2000000;
+		};
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Reader/MsgPackSerializationReader.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class SerializationPlanBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Serialization plans (strategy per member vs compiled plan)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.Add<uint32_t>("uint32")
+					.Add<float>("float")
+					.Add<double>("double")
+					.Add<bool>("bool")
+					.Add<std::string>("string")
+					.BeginType<Wide>("Wide")
+						.RegisterMember(&Wide::A, "A")
+						.RegisterMember(&Wide::B, "B")
+						.RegisterMember(&Wide::C, "C")
+						.RegisterMember(&Wide::D, "D")
+						.RegisterMember(&Wide::E, "E")
+						.RegisterMember(&Wide::F, "F")
+						.RegisterMember(&Wide::G, "G")
+						.RegisterMember(&Wide::H, "H")
+						.RegisterMember(&Wide::I, "I")
+						.RegisterMember(&Wide::J, "J")
+						.RegisterMember(&Wide::K, "K")
+						.RegisterMember(&Wide::L, "L")
+						.RegisterMember(&Wide::M, "M")
+						.RegisterMember(&Wide::N, "N")
+						.RegisterMember(&Wide::O, "O")
+						.RegisterMember(&Wide::P, "P")
+					.EndType<Wide>()
+				.Build();
+
+				const Serialization::Serializer serializer = Serialization::SerializerFactory(library)
+					.LearnType<int32_t, Serialization::Int32SerializationStrategy>()
+					.LearnType<uint32_t, Serialization::UInt32SerializationStrategy>()
+					.LearnType<float, Serialization::FloatSerializationStrategy>()
+					.LearnType<double, Serialization::DoubleSerializationStrategy>()
+					.LearnType<bool, Serialization::BooleanSerializationStrategy>()
+					.LearnType<std::string, Serialization::StringSerializationStrategy>()
+					.LearnType<Wide, Serialization::ObjectSerializationStrategy<Wide>>()
+					.SetFormat(Serialization::SerializationFormat::Short)
+				.Build();
+
+				const Reflection::TypeDescriptor& descriptor = *library.FindDescriptor<Wide>();
+				const Wide value;
+				Serialization::MsgPackSerializationWriter writer;
+
+				// The object strategy alone still dispatches every member through the serializer
+				const double strategySerialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					Serialization::ObjectSerializationStrategy<Wide>::Serialize(descriptor, serializer, &value, writer);
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				const double planSerialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					serializer.Serialize(value, writer);
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				const std::string buffer = writer.GetBuffer();
+				Serialization::MsgPackSerializationReader reader;
+				Wide deserialized;
+
+				const double strategyDeserialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					reader.Import(std::string_view(buffer));
+					Serialization::ObjectSerializationStrategy<Wide>::Deserialize(descriptor, serializer, &deserialized, reader);
+					KeepAlive(deserialized.A);
+				});
+
+				const double planDeserialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					reader.Import(std::string_view(buffer));
+					serializer.Deserialize(deserialized, reader);
+					KeepAlive(deserialized.A);
+				});
+
+				WriteResult(output, "strategy serialize (16 members)", strategySerialize, "object");
+				WriteResult(output, "plan serialize (16 members)", planSerialize, "object");
+				WriteResult(output, "strategy deserialize (16 members)", strategyDeserialize, "object");
+				WriteResult(output, "plan deserialize (16 members)", planDeserialize, "object");
+			}
+
+		private:
+			struct Wide
+			{
+				int32_t A = 1;
+				int32_t B = -2;
+				int32_t C = 300;
+				int32_t D = -40000;
+				uint32_t E = 5;
+				uint32_t F = 600000;
+				float G = 0.5f;
+				float H = 1.25f;
+				double I = 3.75;
+				double J = -0.125;
+				double K = 1e10;
+				bool L = true;
+				bool M = false;
+				std::string N = "name";
+				std::string O = "description";
+				int32_t P = 16;
+			};
+
+			static constexpr uint64_t kIterations = 500000;
+		};
+	}
+}
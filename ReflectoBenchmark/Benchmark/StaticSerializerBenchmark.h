@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/StaticSerializer.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+#include "Utils/StringExt.h"
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		struct StaticSerializerRecord
+		{
+			int32_t Id = 0;
+			std::string Name;
+			double Weight = 0;
+			bool Active = false;
+			std::vector<int32_t> Scores;
+		};
+	}
+
+	namespace Serialization
+	{
+		template<>
+		struct StaticTypeRegistration<Benchmark::StaticSerializerRecord>
+		{
+			static constexpr auto kMembers = std::make_tuple(
+				StaticMember("Id", &Benchmark::StaticSerializerRecord::Id),
+				StaticMember("Name", &Benchmark::StaticSerializerRecord::Name),
+				StaticMember("Weight", &Benchmark::StaticSerializerRecord::Weight),
+				StaticMember("Active", &Benchmark::StaticSerializerRecord::Active),
+				StaticMember("Scores", &Benchmark::StaticSerializerRecord::Scores)
+			);
+		};
+	}
+
+	namespace Benchmark
+	{
+		class StaticSerializerBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Static serializer (dynamic serializer vs compile time serializer)");
+
+				const Reflection::TypeLibrary library = Reflection::TypeLibraryFactory()
+					.Add<int32_t>("int32")
+					.Add<double>("double")
+					.Add<bool>("bool")
+					.Add<std::string>("string")
+					.Add<std::vector<int32_t>>("vector<int32>")
+					.BeginType<StaticSerializerRecord>("Record")
+						.RegisterMember(&StaticSerializerRecord::Id, "Id")
+						.RegisterMember(&StaticSerializerRecord::Name, "Name")
+						.RegisterMember(&StaticSerializerRecord::Weight, "Weight")
+						.RegisterMember(&StaticSerializerRecord::Active, "Active")
+						.RegisterMember(&StaticSerializerRecord::Scores, "Scores")
+					.EndType<StaticSerializerRecord>()
+					.Add<std::vector<StaticSerializerRecord>>("vector<Record>")
+				.Build();
+
+				const Serialization::Serializer serializer = Serialization::SerializerFactory(library)
+					.LearnType<int32_t, Serialization::Int32SerializationStrategy>()
+					.LearnType<double, Serialization::DoubleSerializationStrategy>()
+					.LearnType<bool, Serialization::BooleanSerializationStrategy>()
+					.LearnType<std::string, Serialization::StringSerializationStrategy>()
+					.LearnType<std::vector<int32_t>, Serialization::VectorSerializationStrategy<std::vector<int32_t>>>()
+					.LearnType<StaticSerializerRecord, Serialization::ObjectSerializationStrategy<StaticSerializerRecord>>()
+					.LearnType<std::vector<StaticSerializerRecord>, Serialization::VectorSerializationStrategy<std::vector<StaticSerializerRecord>>>()
+					.SetFormat(Serialization::SerializationFormat::Short)
+				.Build();
+
+				std::vector<StaticSerializerRecord> records(kRecordCount);
+				for (uint32_t i = 0; i < kRecordCount; ++i)
+				{
+					records[i].Id = i;
+					records[i].Name = StringExt::Format<std::string>("Record%u", i);
+					records[i].Weight = i * 0.25;
+					records[i].Active = i % 2 == 0;
+					records[i].Scores = { 1, 20, 300 };
+				}
+
+				Run<Serialization::JsonStreamSerializationWriter>(output, "JSON", serializer, records);
+				Run<Serialization::MsgPackSerializationWriter>(output, "MessagePack", serializer, records);
+			}
+
+		private:
+			template<typename writer_t, typename stream_t>
+			void Run(stream_t& output, const std::string& name, const Serialization::Serializer& serializer, const std::vector<StaticSerializerRecord>& records)
+			{
+				writer_t writer;
+				const double dynamicSerialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					serializer.Serialize(records, writer);
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				const double staticSerialize = MeasureNanosecondsPerIteration(kIterations, [&] {
+					writer.Clear();
+					Serialization::StaticSerializer<std::vector<StaticSerializerRecord>, writer_t>::Serialize(records, writer);
+					KeepAlive(writer.GetBuffer().size());
+				});
+
+				WriteResult(output, name + " dynamic serialize", dynamicSerialize / kRecordCount, "record");
+				WriteResult(output, name + " static serialize", staticSerialize / kRecordCount, "record");
+			}
+
+			static constexpr uint32_t kRecordCount = 10000;
+			static constexpr uint64_t kIterations = 20;
+		};
+	}
+}
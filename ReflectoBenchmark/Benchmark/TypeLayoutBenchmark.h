@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/MemberDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Utils/StringExt.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class TypeLayoutBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "Member walk (descriptors vs flat layout)");
+				for (uint32_t typeCount : { 100, 10000 })
+				{
+					Run(output, typeCount);
+				}
+			}
+
+		private:
+			template<typename stream_t>
+			void Run(stream_t& output, uint32_t typeCount)
+			{
+				const Reflection::TypeLibrary library(BuildTypes(typeCount));
+				const std::vector<Reflection::TypeDescriptorPtr>& types = library.GetDescriptors();
+				const uint64_t iterations = std::max<uint64_t>(10, kWorkBudget / (typeCount * kMemberCount));
+
+				// Visit every member of every type, reading what a serializer needs: offset and member type
+				const double descriptors = MeasureNanosecondsPerIteration(iterations, [&] {
+					uint64_t checksum = 0;
+					for (const Reflection::TypeDescriptorPtr& type : types)
+					{
+						for (const Reflection::MemberDescriptor& member : type->GetMembers())
+						{
+							checksum += member.GetOffset() ^ member.GetType()->GetHash();
+						}
+					}
+					KeepAlive(checksum);
+				});
+
+				const Reflection::TypeLibraryLayout& layout = library.GetLayout();
+				const double flat = MeasureNanosecondsPerIteration(iterations, [&] {
+					uint64_t checksum = 0;
+					for (uint32_t typeIndex = 0; typeIndex < typeCount; ++typeIndex)
+					{
+						for (const Reflection::MemberLayout& member : layout.GetMembers(typeIndex))
+						{
+							checksum += member.offset ^ member.typeIndex;
+						}
+					}
+					KeepAlive(checksum);
+				});
+
+				const double memberCount = static_cast<double>(typeCount) * kMemberCount;
+				WriteResult(output, StringExt::Format<std::string>("%u types, descriptors", typeCount), descriptors / memberCount, "member");
+				WriteResult(output, StringExt::Format<std::string>("%u types, flat layout", typeCount), flat / memberCount, "member");
+			}
+
+			static std::vector<Reflection::TypeDescriptorPtr> BuildTypes(uint32_t typeCount)
+			{
+				std::vector<Reflection::TypeDescriptorPtr> types;
+				types.reserve(typeCount);
+				for (uint32_t i = 0; i < typeCount; ++i)
+				{
+					// Members refer to previously built types, as a real library would
+					std::vector<Reflection::MemberDescriptor> members;
+					for (uint32_t member = 0; member < kMemberCount && i > 0; ++member)
+					{
+						const Reflection::TypeDescriptorPtr& memberType = types[(i * 7 + member * 13) % i];
+						members.emplace_back(memberType, StringExt::Format<std::string>("Member%u", member), member * 8);
+					}
+
+					const std::string name = StringExt::Format<std::string>("Namespace::SyntheticType%u", i);
+					const Reflection::typehash_t hash = std::hash<std::string>()(name);
+					types.push_back(std::make_shared<Reflection::TypeDescriptor>(name, Reflection::TypeExt::GetTypeInfo<void>(), hash, std::nullopt, members, std::vector<Reflection::MethodDescriptor>(), std::vector<Reflection::ValueDescriptor>()));
+				}
+				return types;
+			}
+
+			static constexpr uint32_t kMemberCount = 8;
+			static constexpr uint64_t kWorkBudget = 200000000;
+		};
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Utils/StringExt.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class TypeLibraryBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "TypeLibrary lookup (linear scan vs index)");
+				for (uint32_t typeCount : { 10, 100, 1000, 10000 })
+				{
+					Run(output, typeCount);
+				}
+			}
+
+		private:
+			template<typename stream_t>
+			void Run(stream_t& output, uint32_t typeCount)
+			{
+				const std::vector<Reflection::TypeDescriptorPtr> types = BuildTypes(typeCount);
+				const Reflection::TypeLibrary library(types);
+
+				// Query in a shuffled order so the scan does not benefit from locality
+				std::vector<uint32_t> queries(kQueryCount);
+				std::mt19937 random(typeCount);
+				std::uniform_int_distribution<uint32_t> distribution(0, typeCount - 1);
+				std::generate(queries.begin(), queries.end(), [&] { return distribution(random); });
+
+				size_t next = 0;
+				const uint64_t iterations = std::max<uint64_t>(kMinIterations, kWorkBudget / typeCount);
+
+				const double scanHash = MeasureNanosecondsPerIteration(iterations, [&] {
+					const Reflection::typehash_t hash = types[queries[next++ % kQueryCount]]->GetHash();
+					const auto found = std::find_if(types.begin(), types.end(), [&](const auto& type) { return type->GetHash() == hash; });
+					KeepAlive(found != types.end());
+				});
+
+				const double indexHash = MeasureNanosecondsPerIteration(iterations, [&] {
+					const Reflection::typehash_t hash = types[queries[next++ % kQueryCount]]->GetHash();
+					KeepAlive(library.GetDescriptorByHash(hash).get());
+				});
+
+				const double scanName = MeasureNanosecondsPerIteration(iterations, [&] {
+					const std::string& name = types[queries[next++ % kQueryCount]]->GetName();
+					const auto found = std::find_if(types.begin(), types.end(), [&](const auto& type) { return type->GetName() == name; });
+					KeepAlive(found != types.end());
+				});
+
+				const double indexName = MeasureNanosecondsPerIteration(iterations, [&] {
+					const std::string& name = types[queries[next++ % kQueryCount]]->GetName();
+					KeepAlive(library.GetDescriptorByName(name).get());
+				});
+
+				WriteResult(output, StringExt::Format<std::string>("%u types, by hash, linear scan", typeCount), scanHash, "lookup");
+				WriteResult(output, StringExt::Format<std::string>("%u types, by hash, index", typeCount), indexHash, "lookup");
+				WriteResult(output, StringExt::Format<std::string>("%u types, by name, linear scan", typeCount), scanName, "lookup");
+				WriteResult(output, StringExt::Format<std::string>("%u types, by name, index", typeCount), indexName, "lookup");
+			}
+
+			static std::vector<Reflection::TypeDescriptorPtr> BuildTypes(uint32_t typeCount)
+			{
+				std::vector<Reflection::TypeDescriptorPtr> types;
+				types.reserve(typeCount);
+				for (uint32_t i = 0; i < typeCount; ++i)
+				{
+					const std::string name = StringExt::Format<std::string>("Namespace::SyntheticType%u", i);
+					const Reflection::typehash_t hash = std::hash<std::string>()(name);
+					types.push_back(std::make_shared<Reflection::TypeDescriptor>(name, Reflection::TypeExt::GetTypeInfo<void>(), hash));
+				}
+				return types;
+			}
+
+			static constexpr size_t kQueryCount = 4096;
+			static constexpr uint64_t kMinIterations = 20000;
+			static constexpr uint64_t kWorkBudget = 200000000;
+		};
+	}
+}
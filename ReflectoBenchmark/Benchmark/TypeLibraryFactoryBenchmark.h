@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include "Type/MemberDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+#include "Utils/StringExt.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Benchmark
+	{
+		class TypeLibraryFactoryBenchmark
+		{
+		public:
+			template<typename stream_t>
+			void Run(stream_t& output)
+			{
+				WriteHeader(output, "TypeLibraryFactory registration (startup)");
+				for (uint32_t typeCount : { 1000, 10000, 50000 })
+				{
+					Run(output, typeCount);
+				}
+			}
+
+		private:
+			template<typename stream_t>
+			void Run(stream_t& output, uint32_t typeCount)
+			{
+				const std::vector<Reflection::TypeDescriptorPtr> types = BuildTypes(typeCount);
+				const uint64_t iterations = std::max<uint64_t>(3, kWorkBudget / typeCount);
+
+				// Registration and link pass; a cost per type that stays flat means registration is linear
+				const double registration = MeasureNanosecondsPerIteration(iterations, [&] {
+					Reflection::TypeLibraryFactory factory;
+					for (const Reflection::TypeDescriptorPtr& type : types)
+					{
+						factory.Add(type);
+					}
+					const Reflection::TypeLibrary library = factory.Build();
+					KeepAlive(library.GetDescriptors().size());
+				});
+
+				WriteResult(output, StringExt::Format<std::string>("%u types", typeCount), registration / typeCount, "type");
+			}
+
+			static std::vector<Reflection::TypeDescriptorPtr> BuildTypes(uint32_t typeCount)
+			{
+				std::vector<std::string> names(typeCount);
+				for (uint32_t i = 0; i < typeCount; ++i)
+				{
+					names[i] = StringExt::Format<std::string>("Namespace::SyntheticType%u", i);
+				}
+
+				std::vector<Reflection::TypeDescriptorPtr> types;
+				types.reserve(typeCount);
+				for (uint32_t i = 0; i < typeCount; ++i)
+				{
+					// Members refer to types registered later, which the link pass resolves
+					std::vector<Reflection::MemberDescriptor> members;
+					for (uint32_t member = 0; member < kMemberCount; ++member)
+					{
+						const uint32_t memberType = (i + 1 + member * 31) % typeCount;
+						members.emplace_back(HashName(names[memberType]), StringExt::Format<std::string>("Member%u", member), member * 8);
+					}
+					types.push_back(std::make_shared<Reflection::TypeDescriptor>(names[i], Reflection::TypeExt::GetTypeInfo<void>(), HashName(names[i]), std::nullopt, members, std::vector<Reflection::MethodDescriptor>(), std::vector<Reflection::ValueDescriptor>()));
+				}
+				return types;
+			}
+
+			static Reflection::typehash_t HashName(const std::string& name)
+			{
+				return Reflection::TypeExt::HashTypeName(name);
+			}
+
+			static constexpr uint32_t kMemberCount = 4;
+			static constexpr uint64_t kWorkBudget = 500000;
+		};
+	}
+}
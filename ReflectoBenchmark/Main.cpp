@@ -0,0 +1,108 @@
+#include "Benchmark/BinarySerializationBenchmark.h"
+#include "Benchmark/BlobBenchmark.h"
+#include "Benchmark/ConstructionBenchmark.h"
+#include "Benchmark/DescriptorHandleBenchmark.h"
+#include "Benchmark/FileLoadBenchmark.h"
+#include "Benchmark/JsonReaderBenchmark.h"
+#include "Benchmark/JsonStructuralIndexBenchmark.h"
+#include "Benchmark/JsonWriterBenchmark.h"
+#include "Benchmark/MethodInvocationBenchmark.h"
+#include "Benchmark/NumberArrayBenchmark.h"
+#include "Benchmark/ReflectedValueBenchmark.h"
+#include "Benchmark/SerializationPlanBenchmark.h"
+#include "Benchmark/StaticSerializerBenchmark.h"
+#include "Benchmark/TypeLayoutBenchmark.h"
+#include "Benchmark/TypeLibraryBenchmark.h"
+#include "Benchmark/TypeLibraryFactoryBenchmark.h"
+
+#include <iostream>
+#include <string>
+
+using namespace Reflecto;
+
+int main(int argc, char* argv[])
+{
+	// Optional filter on benchmark name, e.g. "ReflectoBenchmark TypeLibrary"
+	const std::string filter = argc > 1 ? argv[1] : "";
+	auto& output = std::cout;
+
+	if (filter.empty() || filter == "TypeLibrary")
+	{
+		Benchmark::TypeLibraryBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "DescriptorHandle")
+	{
+		Benchmark::DescriptorHandleBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "TypeLayout")
+	{
+		Benchmark::TypeLayoutBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "TypeLibraryFactory")
+	{
+		Benchmark::TypeLibraryFactoryBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "MethodInvocation")
+	{
+		Benchmark::MethodInvocationBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "ReflectedValue")
+	{
+		Benchmark::ReflectedValueBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "Construction")
+	{
+		Benchmark::ConstructionBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "JsonWriter")
+	{
+		Benchmark::JsonWriterBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "JsonReader")
+	{
+		Benchmark::JsonReaderBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "FileLoad")
+	{
+		Benchmark::FileLoadBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "JsonStructuralIndex")
+	{
+		Benchmark::JsonStructuralIndexBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "BinarySerialization")
+	{
+		Benchmark::BinarySerializationBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "SerializationPlan")
+	{
+		Benchmark::SerializationPlanBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "StaticSerializer")
+	{
+		Benchmark::StaticSerializerBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "NumberArray")
+	{
+		Benchmark::NumberArrayBenchmark().Run(output);
+	}
+
+	if (filter.empty() || filter == "Blob")
+	{
+		Benchmark::BlobBenchmark().Run(output);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define REFLECTO_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define REFLECTO_TARGET_AVX2
+#else
+#define REFLECTO_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace Reflecto
+{
+	namespace CpuExt
+	{
+#ifdef REFLECTO_X64
+		inline bool HasAvx2()
+		{
+#ifdef _MSC_VER
+			// Processor must have AVX2 and the operating system must save the YMM registers
+			int info[4];
+			__cpuid(info, 0);
+			const bool hasLeaf7 = info[0] >= 7;
+			__cpuid(info, 1);
+			const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+			__cpuidex(info, 7, 0);
+			return hasLeaf7 && osSavesYmm && (info[1] & (1 << 5)) != 0;
+#else
+			return __builtin_cpu_supports("avx2");
+#endif
+		}
+#endif
+	}
+}
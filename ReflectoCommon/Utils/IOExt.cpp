@@ -0,0 +1,76 @@
+#include "IOExt.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool Reflecto::IOExt::MappedFile::Open(const std::string& file)
+{
+	Close();
+
+	bool success = false;
+#ifdef _WIN32
+	const HANDLE fileHandle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (fileHandle != INVALID_HANDLE_VALUE)
+	{
+		LARGE_INTEGER size = {};
+		if (GetFileSizeEx(fileHandle, &size) && size.QuadPart > 0)
+		{
+			const HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mappingHandle)
+			{
+				// The view keeps the mapping alive once mapped
+				_data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+				_size = _data ? static_cast<size_t>(size.QuadPart) : 0;
+				CloseHandle(mappingHandle);
+			}
+		}
+		success = _data != nullptr || size.QuadPart == 0;
+		CloseHandle(fileHandle);
+	}
+#else
+	const int fileDescriptor = open(file.c_str(), O_RDONLY);
+	if (fileDescriptor >= 0)
+	{
+		struct stat status = {};
+		if (fstat(fileDescriptor, &status) == 0 && status.st_size > 0)
+		{
+			void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (data != MAP_FAILED)
+			{
+				madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+				_data = static_cast<const char*>(data);
+				_size = static_cast<size_t>(status.st_size);
+			}
+		}
+		success = _data != nullptr || status.st_size == 0;
+		close(fileDescriptor);
+	}
+#endif
+	return success;
+}
+
+void Reflecto::IOExt::MappedFile::Close()
+{
+	if (_data)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(_data);
+#else
+		munmap(const_cast<char*>(_data), _size);
+#endif
+	}
+	_data = nullptr;
+	_size = 0;
+}
@@ -6,6 +6,8 @@
 #include <iostream>
 #include <iterator>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace Reflecto
@@ -19,22 +21,91 @@ namespace Reflecto
             std::copy(bytes.begin(), bytes.end(), std::ostream_iterator<char>(outstream));
         }
 
+        // Reads the whole file with a single read of its size
+        inline bool ReadFromFile(const std::string& file, std::string& content)
+        {
+            bool success = false;
+            std::ifstream fileReader(file, std::ios::in | std::ios::binary | std::ios::ate);
+            if (fileReader)
+            {
+                const std::streamsize size = fileReader.tellg();
+                if (size != -1)
+                {
+                    content.resize(static_cast<size_t>(size));
+                    fileReader.seekg(0);
+                    success = static_cast<bool>(fileReader.read(content.data(), size));
+                }
+            }
+            return success;
+        }
+
         inline std::vector<char> ReadFromFile(const std::string& file)
         {
             std::vector<char> bytes;
+            std::ifstream fileReader(file, std::ios::in | std::ios::binary | std::ios::ate);
+            if (fileReader)
             {
-                std::ifstream fileReader;
-                fileReader.open(file, std::ios::in | std::ios::binary);
-                fileReader.unsetf(std::ios::skipws);
-                std::copy(
-                    std::istream_iterator<char>(fileReader),
-                    std::istream_iterator<char>(),
-                    std::back_inserter(bytes)
-                );
+                const std::streamsize size = fileReader.tellg();
+                if (size != -1)
+                {
+                    bytes.resize(static_cast<size_t>(size));
+                    fileReader.seekg(0);
+                    fileReader.read(bytes.data(), size);
+                }
             }
             return bytes;
         }
 
+		// Read only view of a file mapped in memory, unmapped on destruction
+		class MappedFile
+		{
+		public:
+			MappedFile() = default;
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			MappedFile(MappedFile&& other)
+			{
+				*this = std::move(other);
+			}
+
+			MappedFile& operator=(MappedFile&& other)
+			{
+				if (this != &other)
+				{
+					Close();
+					std::swap(_data, other._data);
+					std::swap(_size, other._size);
+				}
+				return *this;
+			}
+
+			~MappedFile()
+			{
+				Close();
+			}
+
+			// Platform specific, defined in IOExt.cpp to keep system headers out of this one
+			bool Open(const std::string& file);
+
+			void Close();
+
+			std::string_view GetView() const
+			{
+				return std::string_view(_data ? _data : "", _size);
+			}
+
+		private:
+			const char* _data = nullptr;
+			size_t _size = 0;
+		};
+
+		inline bool MapFile(const std::string& file, MappedFile& mappedFile)
+		{
+			return mappedFile.Open(file);
+		}
+
 		template <typename stream_t>
 		static uint32_t WriteBytes(const char* addr, uint32_t size, stream_t& stream)
 		{
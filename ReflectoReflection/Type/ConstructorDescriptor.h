@@ -4,8 +4,10 @@
 #include "Utils/AnyExt.h"
 
 #include <any>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 
 namespace Reflecto
 {
@@ -19,10 +21,71 @@ namespace Reflecto
 
 			using weak_construction_func_t = std::function<std::unique_ptr<std::any>()>;
 
+			// Lifecycle operations on raw storage of GetSize() bytes aligned on GetAlignment()
+			using construct_func_t = void(*)(void* address);
+			using move_construct_func_t = void(*)(void* address, void* source);
+			using destroy_func_t = void(*)(void* address);
+
 			ConstructorDescriptor(const weak_construction_func_t& constructor)
+				: ConstructorDescriptor(constructor, 0, 0, nullptr, nullptr, nullptr)
+			{  }
+
+			ConstructorDescriptor(const weak_construction_func_t& constructor, size_t size, size_t alignment, construct_func_t construct, move_construct_func_t moveConstruct, destroy_func_t destroy)
 				: _constructor(constructor)
+				, _size(size)
+				, _alignment(alignment)
+				, _construct(construct)
+				, _moveConstruct(moveConstruct)
+				, _destroy(destroy)
 			{  }
 
+			size_t GetSize() const
+			{
+				return _size;
+			}
+
+			size_t GetAlignment() const
+			{
+				return _alignment;
+			}
+
+			bool HasLifecycle() const
+			{
+				return _construct && _moveConstruct && _destroy;
+			}
+
+			// Default constructs an instance at address, which must not hold a live object
+			void Construct(void* address) const
+			{
+				_construct(address);
+			}
+
+			// Move constructs an instance at address from the instance at source, which is left alive
+			void MoveConstruct(void* address, void* source) const
+			{
+				_moveConstruct(address, source);
+			}
+
+			void Destroy(void* address) const
+			{
+				_destroy(address);
+			}
+
+			// Allocates from resource, such as an arena or a pool, and default constructs there
+			void* New(std::pmr::memory_resource& resource) const
+			{
+				void* address = resource.allocate(_size, _alignment);
+				Construct(address);
+				return address;
+			}
+
+			// Destroys an instance created by New and returns its storage to the same resource
+			void Delete(std::pmr::memory_resource& resource, void* address) const
+			{
+				Destroy(address);
+				resource.deallocate(address, _size, _alignment);
+			}
+
 			template<typename object_t>
 			const construction_func_t<object_t> GetConstructorMethod() const
 			{
@@ -32,7 +95,7 @@ namespace Reflecto
 				{
 					constructorMethod = [weakConstructorMethod = weakConstructorMethod] {
 						std::unique_ptr<std::any> anyValue = weakConstructorMethod();
-						return object_t();
+						return std::make_unique<object_t>(std::any_cast<object_t&&>(std::move(*anyValue)));
 					};
 				}
 				return constructorMethod;
@@ -57,6 +120,11 @@ namespace Reflecto
 
 		private:
 			std::any _constructor;
+			size_t _size;
+			size_t _alignment;
+			construct_func_t _construct;
+			move_construct_func_t _moveConstruct;
+			destroy_func_t _destroy;
 		};
 	}
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "ConstructorDescriptor.h"
 
 #include <memory>
+#include <new>
+#include <utility>
 
 namespace Reflecto
 {
@@ -22,11 +24,26 @@ namespace Reflecto
 
 			ConstructorDescriptor Build()
 			{
-				return ConstructorDescriptor(_constructor);
+				return ConstructorDescriptor(_constructor, sizeof(object_t), alignof(object_t), &Construct, &MoveConstruct, &Destroy);
 			}
 
 		private:
+			static void Construct(void* address)
+			{
+				new (address) object_t();
+			}
+
+			static void MoveConstruct(void* address, void* source)
+			{
+				new (address) object_t(std::move(*static_cast<object_t*>(source)));
+			}
+
+			static void Destroy(void* address)
+			{
+				static_cast<object_t*>(address)->~object_t();
+			}
+
 			ConstructorDescriptor::weak_construction_func_t _constructor;
 		};
 	}
-}
\ No newline at end of file
+}
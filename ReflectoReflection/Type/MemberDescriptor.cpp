@@ -7,9 +7,16 @@
 
 #include <string>
 
+Reflecto::Reflection::MemberDescriptor::MemberDescriptor(const TypeDescriptorPtr& type, const std::string& name, uint32_t offset)
+	: _typeHash(type ? type->GetHash() : 0)
+	, _type(type.get())
+	, _name(name)
+	, _offset(offset)
+{ }
+
 bool Reflecto::Reflection::MemberDescriptor::operator<(const MemberDescriptor& other) const
 {
-	return std::tie(_name, GetType()) < std::tie(other._name, GetType());
+	return std::tie(_name, _type) < std::tie(other._name, other._type);
 }
 
 std::string Reflecto::Reflection::MemberDescriptor::ToString() const
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 namespace Reflecto
 {
@@ -20,27 +21,82 @@ namespace Reflecto
 		class MemberDescriptor : public RelationalOperators<MemberDescriptor>
 		{
 		public:
-			MemberDescriptor(const TypeDescriptorPtr& type, const std::string& name, byte offset)
-				: _type(type)
+			MemberDescriptor(typehash_t typeHash, const std::string& name, uint32_t offset)
+				: _typeHash(typeHash)
+				, _type(nullptr)
 				, _name(name)
 				, _offset(offset)
 			{ }
 
-			const TypeDescriptorPtr& GetType() const
+			// Member without a fixed offset, reached through path and then pointerAccess when set
+			MemberDescriptor(typehash_t typeHash, const std::string& name, const std::vector<SubobjectStep>& path, const MemberPointerAccess& pointerAccess)
+				: _typeHash(typeHash)
+				, _type(nullptr)
+				, _name(name)
+				, _offset(kNoOffset)
+				, _path(path)
+				, _pointerAccess(pointerAccess)
+			{ }
+
+			MemberDescriptor(const TypeDescriptorPtr& type, const std::string& name, uint32_t offset);
+
+			// Borrowed from the type library, resolved when the library is built
+			const TypeDescriptor* GetType() const
 			{
 				return _type;
 			}
 
+			typehash_t GetTypeHash() const
+			{
+				return _typeHash;
+			}
+
+			void Link(const TypeDescriptor* type)
+			{
+				_type = type;
+			}
+
 			const std::string& GetName() const
 			{
 				return _name;
 			}
 
+			// kNoOffset for members without a fixed offset
 			const uint32_t GetOffset() const
 			{
 				return _offset;
 			}
 
+			bool HasOffset() const
+			{
+				return _offset != kNoOffset;
+			}
+
+			// Same member seen from a type holding it at the end of basePath, such as a derived type
+			MemberDescriptor Rebase(const std::vector<SubobjectStep>& basePath) const
+			{
+				MemberDescriptor member = *this;
+				const bool fixedBase = basePath.empty() || (basePath.size() == 1 && !basePath.front().cast);
+				if (fixedBase && HasOffset())
+				{
+					member._offset += basePath.empty() ? 0 : basePath.front().offset;
+				}
+				else
+				{
+					member._offset = kNoOffset;
+					member._path = basePath;
+					for (const SubobjectStep& step : _path)
+					{
+						TypeExt::AppendSubobjectStep(member._path, step);
+					}
+					if (HasOffset())
+					{
+						TypeExt::AppendSubobjectStep(member._path, SubobjectStep{ _offset, nullptr });
+					}
+				}
+				return member;
+			}
+
 			template<typename object_t, typename member_t>
 			member_t* ResolveMember(object_t& object) const
 			{
@@ -75,9 +131,17 @@ namespace Reflecto
 
 			const void* ResolveMember(const void* object) const
 			{
-				const byte* objRawAddr = reinterpret_cast<const byte*>(object);
-				const byte* memberRawAddr = objRawAddr + GetOffset();
-				return memberRawAddr;
+				const void* member = nullptr;
+				if (HasOffset())
+				{
+					member = static_cast<const byte*>(object) + _offset;
+				}
+				else
+				{
+					member = TypeExt::ResolveSubobjectPath(object, _path);
+					member = _pointerAccess.apply ? _pointerAccess.apply(member, _pointerAccess.memberPointer) : member;
+				}
+				return member;
 			}
 
 			bool operator<(const MemberDescriptor& other) const;
@@ -85,9 +149,12 @@ namespace Reflecto
 			std::string ToString() const;
 
 		private:
-			TypeDescriptorPtr _type;
+			typehash_t _typeHash;
+			const TypeDescriptor* _type;
 			std::string _name;
 			uint32_t _offset;
+			std::vector<SubobjectStep> _path;
+			MemberPointerAccess _pointerAccess;
 		};
 	}
 }
\ No newline at end of file
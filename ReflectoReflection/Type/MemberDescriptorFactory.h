@@ -2,8 +2,7 @@
 
 #include "MemberDescriptor.h"
 #include "TypeDescriptor.h"
-#include "TypeDescriptorFactory.h"
-#include "TypeLibrary.h"
+#include "TypeExt.h"
 
 #include <assert.h>
 
@@ -11,32 +10,38 @@ namespace Reflecto
 {
 	namespace Reflection
 	{
+		// Members are located from object_t, also when the member pointer is one of a parent. Those
+		// of object_t and of its non-virtual parents are at the offset measured on sample when there
+		// is one, others are reached through the member pointer.
 		template <typename object_t, typename member_t>
 		class MemberDescriptorFactory
 		{
 		public:
-			using member_pointer_t = typename member_t object_t::*;
-
-			MemberDescriptorFactory(const TypeLibrary& typeLibrary, object_t& sampleObj, member_pointer_t memberPointer, const std::string& memberName)
-				: _typeLibrary(typeLibrary)
-				, _sampleObj(sampleObj)
-				, _memberPointer(memberPointer)
-				, _name(memberName)
-			{ }
+			template <typename owner_t>
+			MemberDescriptorFactory(member_t owner_t::* memberPointer, const std::string& memberName, const object_t* sample)
+				: _name(memberName)
+				, _offset(kNoOffset)
+			{
+				if constexpr (TypeExt::IsFixedSubobject<object_t, owner_t>())
+				{
+					_offset = sample ? TypeExt::ComputeMemberOffset(*sample, memberPointer) : kNoOffset;
+				}
+				if (_offset == kNoOffset)
+				{
+					_pointerAccess = TypeExt::GetMemberPointerAccess<object_t>(memberPointer);
+				}
+			}
 
 			MemberDescriptor Build()
 			{
-				byte offset = TypeExt::ComputeMemberOffset(_sampleObj, _memberPointer);
-				const TypeDescriptorPtr type = _typeLibrary.GetDescriptor<member_t>();
-				ensure(type);
-				return MemberDescriptor{ type, _name, offset };
+				const typehash_t typeHash = TypeExt::GetTypeHash<member_t>();
+				return _offset != kNoOffset ? MemberDescriptor{ typeHash, _name, _offset } : MemberDescriptor{ typeHash, _name, {}, _pointerAccess };
 			}
 
 		private:
-			TypeLibrary _typeLibrary;
-			object_t _sampleObj;
-			member_pointer_t _memberPointer;
 			std::string _name;
+			uint32_t _offset;
+			MemberPointerAccess _pointerAccess;
 		};
 	}
 }
\ No newline at end of file
@@ -7,9 +7,14 @@
 
 #include <string>
 
+Reflecto::Reflection::typehash_t Reflecto::Reflection::MethodDescriptor::GetHash(const TypeDescriptorPtr& type)
+{
+	return type ? type->GetHash() : 0;
+}
+
 bool Reflecto::Reflection::MethodDescriptor::operator<(const MethodDescriptor& other) const
 {
-	return std::tie(_name, GetReturnType(), _parameters) < std::tie(other._name, other.GetReturnType(), other._parameters);
+	return std::tie(_name, _returnType, _parameters) < std::tie(other._name, other._returnType, other._parameters);
 }
 
 std::string Reflecto::Reflection::MethodDescriptor::ToString() const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "MethodInvoker.h"
 #include "ParameterDescriptor.h"
 
 #include "Utils/AnyExt.h"
@@ -35,9 +36,22 @@ namespace Reflecto
 			template<std::size_t nb_param_t>
 			using weak_resolved_method_t = std::function<std::any(const weak_method_params_t<nb_param_t>&)>;
 
+			template<typename object_t, typename return_t = void, size_t nb_param_t>
+			MethodDescriptor(typehash_t returnTypeHash, const std::string& name, const std::vector<ParameterDescriptor>& parameters, weak_method_ptr_t<object_t, nb_param_t> method, const MethodInvoker& invoker = MethodInvoker())
+				: _returnTypeHash(returnTypeHash)
+				, _returnType(nullptr)
+				, _name(name)
+				, _parameters(parameters)
+				, _method(method)
+				, _invoker(invoker)
+			{
+
+			}
+
 			template<typename object_t, typename return_t = void, size_t nb_param_t>
 			MethodDescriptor(const TypeDescriptorPtr& returnType, const std::string& name, const std::vector<ParameterDescriptor>& parameters, weak_method_ptr_t<object_t, nb_param_t> method)
-				: _returnType(returnType)
+				: _returnTypeHash(GetHash(returnType))
+				, _returnType(returnType.get())
 				, _name(name)
 				, _parameters(parameters)
 				, _method(method)
@@ -50,6 +64,24 @@ namespace Reflecto
 				return _name;
 			}
 
+			const MethodInvoker& GetInvoker() const
+			{
+				return _invoker;
+			}
+
+			// Calls the method on object without allocating. args holds the address of each
+			// argument and the result is assigned to *ret when ret is not null.
+			bool Invoke(void* object, void* const* args, void* ret) const
+			{
+				bool success = false;
+				if (_invoker)
+				{
+					_invoker(object, args, ret);
+					success = true;
+				}
+				return success;
+			}
+
 			template<typename object_t, std::size_t nb_param_t>
 			weak_method_ptr_t<object_t, nb_param_t> GetWeakMethod() const
 			{
@@ -74,11 +106,26 @@ namespace Reflecto
 				return method;
 			}
 			
-			const TypeDescriptorPtr& GetReturnType() const
+			const TypeDescriptor* GetReturnType() const
 			{
 				return _returnType;
 			}
 
+			typehash_t GetReturnTypeHash() const
+			{
+				return _returnTypeHash;
+			}
+
+			template<typename resolver_t>
+			void Link(const resolver_t& resolve)
+			{
+				_returnType = resolve(_returnTypeHash);
+				for (ParameterDescriptor& parameter : _parameters)
+				{
+					parameter.Link(resolve(parameter.GetTypeHash()));
+				}
+			}
+
 			const std::vector<ParameterDescriptor>& GetParameters() const
 			{
 				return _parameters;
@@ -137,10 +184,14 @@ namespace Reflecto
 			std::string ToString() const;
 
 		private:
-			TypeDescriptorPtr _returnType;
+			static typehash_t GetHash(const TypeDescriptorPtr& type);
+
+			typehash_t _returnTypeHash;
+			const TypeDescriptor* _returnType;
 			std::string _name;
 			std::vector<ParameterDescriptor> _parameters;
 			std::any _method;
+			MethodInvoker _invoker;
 		};
 	}
 }
\ No newline at end of file
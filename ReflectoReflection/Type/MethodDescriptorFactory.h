@@ -2,7 +2,7 @@
 
 #include "MethodDescriptor.h"
 #include "TypeDescriptor.h"
-#include "TypeLibrary.h"
+#include "TypeExt.h"
 #include "ParameterDescriptorFactory.h"
 
 #include "Common/Ensure.h"
@@ -10,7 +10,10 @@
 #include "Utils/FunctionalExt.h"
 
 #include <assert.h>
+#include <cstring>
 #include <memory.h>
+#include <type_traits>
+#include <utility>
 
 namespace Reflecto
 {
@@ -23,10 +26,8 @@ namespace Reflecto
 			using method_ptr_t = return_t (object_t::*)(params_t ...);
 			static constexpr size_t param_count = sizeof...(params_t);
 
-			MethodDescriptorFactory(const TypeLibrary& typeLibrary, object_t& sampleObj, method_ptr_t methodPointer, const std::string& name, const std::vector<std::string>& parameterNames)
-				: _typeLibrary(typeLibrary)
-				, _sampleObj(sampleObj)
-				, _methodPointer(methodPointer)
+			MethodDescriptorFactory(method_ptr_t methodPointer, const std::string& name, const std::vector<std::string>& parameterNames)
+				: _methodPointer(methodPointer)
 				, _name(name)
 				, _parametersName(parameterNames)
 			{ }
@@ -35,23 +36,24 @@ namespace Reflecto
 			{
 				ensure(param_count == _parametersName.size());
 
-				const TypeDescriptorPtr returnType = _typeLibrary.GetDescriptor<return_t>();
-				const std::vector<ParameterDescriptor> parameters = BuildParameters(_typeLibrary, _parametersName);
+				const typehash_t returnTypeHash = TypeExt::GetTypeHash<return_t>();
+				const std::vector<ParameterDescriptor> parameters = BuildParameters(_parametersName);
 				const MethodDescriptor::weak_method_ptr_t<object_t, param_count> method_wrapper = BuildMethodWrapper();
+				const MethodInvoker invoker(&Invoke, _methodPointer);
 
-				return MethodDescriptor{ returnType, _name, parameters, method_wrapper };
+				return MethodDescriptor{ returnTypeHash, _name, parameters, method_wrapper, invoker };
 			}
 
 		private:
-			static std::vector<ParameterDescriptor> BuildParameters(const TypeLibrary& typeLibrary, const std::vector<std::string>& parameterName)
+			static std::vector<ParameterDescriptor> BuildParameters(const std::vector<std::string>& parameterName)
 			{
-				return BuildParameters(typeLibrary, parameterName, std::make_index_sequence<sizeof...(params_t)>());
+				return BuildParameters(parameterName, std::make_index_sequence<sizeof...(params_t)>());
 			}
 
 			template <size_t... i>
-			static std::vector<ParameterDescriptor> BuildParameters(const TypeLibrary& typeLibrary, const std::vector<std::string>& parametersName, std::index_sequence<i...>)
+			static std::vector<ParameterDescriptor> BuildParameters(const std::vector<std::string>& parametersName, std::index_sequence<i...>)
 			{
-				return { ParameterDescriptorFactory<params_t>(typeLibrary, parametersName[i]).Build()... };
+				return { ParameterDescriptorFactory<params_t>(parametersName[i]).Build()... };
 			}
 
 			static std::tuple<params_t...> CastParameters(const std::array<std::any, param_count>& params)
@@ -65,6 +67,47 @@ namespace Reflecto
 				return std::make_tuple(AnyExt::AnyCast<params_t>(params[i])...);
 			}
 
+			static void Invoke(const void* method, void* object, void* const* args, void* ret)
+			{
+				method_ptr_t methodPointer;
+				std::memcpy(&methodPointer, method, sizeof(method_ptr_t));
+				Invoke(methodPointer, *static_cast<object_t*>(object), args, ret, std::index_sequence_for<params_t...>());
+			}
+
+			template <size_t... i>
+			static void Invoke(method_ptr_t methodPointer, object_t& object, void* const* args, void* ret, std::index_sequence<i...>)
+			{
+				using result_t = std::remove_cv_t<std::remove_reference_t<return_t>>;
+				if constexpr (std::is_void_v<return_t>)
+				{
+					(object.*methodPointer)(ForwardArgument<params_t>(args[i])...);
+				}
+				else if (ret)
+				{
+					*static_cast<result_t*>(ret) = (object.*methodPointer)(ForwardArgument<params_t>(args[i])...);
+				}
+				else
+				{
+					(object.*methodPointer)(ForwardArgument<params_t>(args[i])...);
+				}
+			}
+
+			// Arguments are only moved from for rvalue reference parameters
+			template <typename param_t>
+			static decltype(auto) ForwardArgument(void* arg)
+			{
+				using value_t = std::remove_reference_t<param_t>;
+				value_t& value = *static_cast<value_t*>(arg);
+				if constexpr (std::is_rvalue_reference_v<param_t>)
+				{
+					return std::move(value);
+				}
+				else
+				{
+					return (value);
+				}
+			}
+
 			MethodDescriptor::weak_method_ptr_t<object_t, param_count> BuildMethodWrapper()
 			{
 				return [methodPointer = _methodPointer](object_t* obj, const std::array<std::any, param_count>& params) -> std::any {
@@ -74,8 +117,6 @@ namespace Reflecto
 				};
 			}
 
-			TypeLibrary _typeLibrary;
-			object_t _sampleObj;
 			method_ptr_t _methodPointer;
 			std::string _name;
 			std::vector<std::string> _parametersName;
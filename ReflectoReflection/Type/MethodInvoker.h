@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Common/Definitions.h"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		// Type erased call of a member function through a plain function pointer, without
+		// allocation. Arguments are passed by address in declaration order and the result
+		// is assigned to the object ret points to, unless ret is null.
+		class MethodInvoker
+		{
+		public:
+			// The thunk receives the stored member function pointer as first argument
+			using thunk_t = void(*)(const void* method, void* object, void* const* args, void* ret);
+
+			MethodInvoker()
+				: _thunk(nullptr)
+				, _method()
+			{ }
+
+			template<typename method_ptr_t>
+			MethodInvoker(thunk_t thunk, method_ptr_t method)
+				: _thunk(thunk)
+				, _method()
+			{
+				// Member function pointers are at most a few pointers wide, even with virtual inheritance
+				static_assert(sizeof(method_ptr_t) <= kMaxMethodSize, "Member function pointer is too large");
+				std::memcpy(_method.data(), &method, sizeof(method_ptr_t));
+			}
+
+			explicit operator bool() const
+			{
+				return _thunk != nullptr;
+			}
+
+			void operator()(void* object, void* const* args, void* ret) const
+			{
+				_thunk(_method.data(), object, args, ret);
+			}
+
+		private:
+			static constexpr size_t kMaxMethodSize = 4 * sizeof(void*);
+
+			thunk_t _thunk;
+			alignas(std::max_align_t) std::array<byte, kMaxMethodSize> _method;
+		};
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		// Index over the names of a collection of descriptors, sorted by length then by
+		// content. Lookups compare lengths before touching characters and never allocate.
+		// The index only stores positions, the collection is passed back on lookup.
+		template<typename item_t>
+		class NameIndex
+		{
+		public:
+			NameIndex() = default;
+
+			NameIndex(const std::vector<item_t>& items)
+			{
+				_entries.reserve(items.size());
+				for (uint32_t position = 0; position < items.size(); ++position)
+				{
+					_entries.push_back(Entry{ static_cast<uint32_t>(items[position].GetName().size()), position });
+				}
+
+				// Stable so that the first of several items sharing a name is found
+				std::stable_sort(_entries.begin(), _entries.end(), [&](const Entry& left, const Entry& right) {
+					return Compare(items, left, right.length, items[right.position].GetName()) < 0;
+				});
+			}
+
+			const item_t* Find(const std::vector<item_t>& items, std::string_view name) const
+			{
+				const auto found = std::lower_bound(_entries.begin(), _entries.end(), name, [&](const Entry& entry, std::string_view name) {
+					return Compare(items, entry, static_cast<uint32_t>(name.size()), name) < 0;
+				});
+
+				const bool match = found != _entries.end() && Compare(items, *found, static_cast<uint32_t>(name.size()), name) == 0;
+				return match ? &items[found->position] : nullptr;
+			}
+
+		private:
+			struct Entry
+			{
+				uint32_t length;
+				uint32_t position;
+			};
+
+			static int Compare(const std::vector<item_t>& items, const Entry& entry, uint32_t length, std::string_view name)
+			{
+				int result = 0;
+				if (entry.length != length)
+				{
+					result = entry.length < length ? -1 : 1;
+				}
+				else
+				{
+					result = std::string_view(items[entry.position].GetName()).compare(name);
+				}
+				return result;
+			}
+
+			std::vector<Entry> _entries;
+		};
+	}
+}
@@ -5,9 +5,15 @@
 #include "Common/Ensure.h"
 #include "Utils/StringExt.h"
 
+Reflecto::Reflection::ParameterDescriptor::ParameterDescriptor(const TypeDescriptorPtr& type, const std::string& name)
+	: _typeHash(type ? type->GetHash() : 0)
+	, _type(type.get())
+	, _name(name)
+{ }
+
 bool Reflecto::Reflection::ParameterDescriptor::operator<(const ParameterDescriptor& other) const
 {
-	return std::tie(GetType(), _name) < std::tie(other.GetType(), other._name);
+	return std::tie(_type, _name) < std::tie(other._type, other._name);
 }
 
 std::string Reflecto::Reflection::ParameterDescriptor::ToString() const
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "TypeExt.h"
+
 #include "Utils/RelationalOperators.h"
 
 #include <memory>
@@ -15,18 +17,31 @@ namespace Reflecto
 		class ParameterDescriptor : RelationalOperators<ParameterDescriptor>
 		{
 		public:
-			ParameterDescriptor(const TypeDescriptorPtr& type, const std::string& name)
-				: _type(type)
+			ParameterDescriptor(typehash_t typeHash, const std::string& name)
+				: _typeHash(typeHash)
+				, _type(nullptr)
 				, _name(name)
 			{
 
 			}
 
-			const TypeDescriptorPtr& GetType() const
+			ParameterDescriptor(const TypeDescriptorPtr& type, const std::string& name);
+
+			const TypeDescriptor* GetType() const
 			{
 				return _type;
 			}
 
+			typehash_t GetTypeHash() const
+			{
+				return _typeHash;
+			}
+
+			void Link(const TypeDescriptor* type)
+			{
+				_type = type;
+			}
+
 			const std::string GetName() const
 			{
 				return _name;
@@ -37,7 +52,8 @@ namespace Reflecto
 			std::string ToString() const;
 
 		private:
-			TypeDescriptorPtr _type;
+			typehash_t _typeHash;
+			const TypeDescriptor* _type;
 			std::string _name;
 		};
 	}
@@ -1,7 +1,7 @@
 #pragma once
 
-#include "TypeDescriptor.h"
-#include "TypeLibrary.h"
+#include "ParameterDescriptor.h"
+#include "TypeExt.h"
 
 #include <string>
 
@@ -13,19 +13,16 @@ namespace Reflecto
 		class ParameterDescriptorFactory
 		{
 		public:
-			ParameterDescriptorFactory(const TypeLibrary& typeLibrary, const std::string& name)
-				: _typeLibrary(typeLibrary)
-				, _name(name)
+			ParameterDescriptorFactory(const std::string& name)
+				: _name(name)
 			{ }
 
 			ParameterDescriptor Build()
 			{
-				const TypeDescriptorPtr type = _typeLibrary.GetDescriptor<type_t>();
-				return ParameterDescriptor{ type, _name};
+				return ParameterDescriptor{ TypeExt::GetTypeHash<type_t>(), _name };
 			}
 
 		private:
-			TypeLibrary _typeLibrary;
 			std::string _name;
 		};
 	}
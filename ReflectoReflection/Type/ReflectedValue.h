@@ -0,0 +1,194 @@
+#pragma once
+
+#include "TypeDescriptor.h"
+
+#include "Common/Definitions.h"
+#include "Common/Ensure.h"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		// Owns an instance of a reflected type, constructed through the lifecycle operations of
+		// its constructor descriptor. Values fitting inline_size bytes live in an inline buffer
+		// and never touch the heap, larger ones are constructed in place in a single allocation
+		// from the memory resource of the value.
+		template<size_t inline_size>
+		class BasicReflectedValue
+		{
+		public:
+			BasicReflectedValue()
+				: BasicReflectedValue(*std::pmr::new_delete_resource())
+			{ }
+
+			explicit BasicReflectedValue(std::pmr::memory_resource& resource)
+				: _type(nullptr)
+				, _heap(nullptr)
+				, _resource(&resource)
+				, _buffer()
+			{ }
+
+			BasicReflectedValue(const TypeDescriptor* type)
+				: BasicReflectedValue()
+			{
+				Emplace(type);
+			}
+
+			BasicReflectedValue(const TypeDescriptor* type, std::pmr::memory_resource& resource)
+				: BasicReflectedValue(resource)
+			{
+				Emplace(type);
+			}
+
+			BasicReflectedValue(const BasicReflectedValue&) = delete;
+			BasicReflectedValue& operator=(const BasicReflectedValue&) = delete;
+
+			BasicReflectedValue(BasicReflectedValue&& other)
+				: BasicReflectedValue(*other._resource)
+			{
+				MoveFrom(other);
+			}
+
+			BasicReflectedValue& operator=(BasicReflectedValue&& other)
+			{
+				if (this != &other)
+				{
+					Reset();
+					MoveFrom(other);
+				}
+				return *this;
+			}
+
+			~BasicReflectedValue()
+			{
+				Reset();
+			}
+
+			// Destroys the current value and default constructs an instance of type
+			bool Emplace(const TypeDescriptor* type)
+			{
+				Reset();
+
+				bool success = false;
+				const ConstructorDescriptor* constructor = GetLifecycle(type);
+				if (ensure(constructor))
+				{
+					if (IsInline(*constructor))
+					{
+						constructor->Construct(_buffer.data());
+					}
+					else
+					{
+						_heap = constructor->New(*_resource);
+					}
+					_type = type;
+					success = true;
+				}
+				return success;
+			}
+
+			void Reset()
+			{
+				if (_type)
+				{
+					const ConstructorDescriptor& constructor = *_type->GetConstructor();
+					if (_heap)
+					{
+						constructor.Delete(*_resource, _heap);
+					}
+					else
+					{
+						constructor.Destroy(_buffer.data());
+					}
+				}
+				_type = nullptr;
+				_heap = nullptr;
+			}
+
+			bool HasValue() const
+			{
+				return _type != nullptr;
+			}
+
+			bool IsInline() const
+			{
+				return HasValue() && _heap == nullptr;
+			}
+
+			const TypeDescriptor* GetType() const
+			{
+				return _type;
+			}
+
+			void* GetAddress()
+			{
+				return HasValue() ? (_heap ? _heap : _buffer.data()) : nullptr;
+			}
+
+			const void* GetAddress() const
+			{
+				return const_cast<BasicReflectedValue*>(this)->GetAddress();
+			}
+
+			template<typename value_t>
+			value_t* Get()
+			{
+				return _type && _type->Is<value_t>() ? static_cast<value_t*>(GetAddress()) : nullptr;
+			}
+
+			template<typename value_t>
+			const value_t* Get() const
+			{
+				return const_cast<BasicReflectedValue*>(this)->Get<value_t>();
+			}
+
+		private:
+			static const ConstructorDescriptor* GetLifecycle(const TypeDescriptor* type)
+			{
+				const ConstructorDescriptor* constructor = nullptr;
+				if (type && type->GetConstructor() && type->GetConstructor()->HasLifecycle())
+				{
+					constructor = &(*type->GetConstructor());
+				}
+				return constructor;
+			}
+
+			static bool IsInline(const ConstructorDescriptor& constructor)
+			{
+				return constructor.GetSize() <= inline_size && constructor.GetAlignment() <= alignof(std::max_align_t);
+			}
+
+			void MoveFrom(BasicReflectedValue& other)
+			{
+				if (other._heap && *other._resource == *_resource)
+				{
+					// Heap values change owner without touching the instance
+					_heap = other._heap;
+					_type = other._type;
+					other._heap = nullptr;
+					other._type = nullptr;
+				}
+				else if (other._type)
+				{
+					const ConstructorDescriptor& constructor = *other._type->GetConstructor();
+					void* address = other._heap ? _resource->allocate(constructor.GetSize(), constructor.GetAlignment()) : _buffer.data();
+					constructor.MoveConstruct(address, other.GetAddress());
+					_heap = other._heap ? address : nullptr;
+					_type = other._type;
+					other.Reset();
+				}
+			}
+
+			const TypeDescriptor* _type;
+			void* _heap;
+			std::pmr::memory_resource* _resource;
+			alignas(std::max_align_t) std::array<byte, inline_size> _buffer;
+		};
+
+		using ReflectedValue = BasicReflectedValue<4 * sizeof(void*)>;
+	}
+}
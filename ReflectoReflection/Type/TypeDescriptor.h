@@ -3,12 +3,16 @@
 #include "ConstructorDescriptor.h"
 #include "MemberDescriptor.h"
 #include "MethodDescriptor.h"
+#include "NameIndex.h"
 #include "ValueDescriptor.h"
 #include "TypeExt.h"
 
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace Reflecto
@@ -31,26 +35,30 @@ namespace Reflecto
 			}
 
 			TypeDescriptor(const std::string& name, const std::type_info& typeInfo, typehash_t hash, const OptionalConstructorDescriptor& constructor, const std::vector<MemberDescriptor>& members, const std::vector<MethodDescriptor>& methods, const std::vector<ValueDescriptor>& values)
-				: TypeDescriptor(name, typeInfo, hash, TypeDescriptorPtr(), constructor, members, methods, values)
+				: TypeDescriptor(name, typeInfo, hash, TypeParent(), constructor, members, methods, values)
 			{ }
 
-			TypeDescriptor(const std::string& name, const std::type_info& typeInfo, typehash_t hash, const TypeDescriptorPtr& parent, const OptionalConstructorDescriptor& constructor, const std::vector<MemberDescriptor>& members, const std::vector<MethodDescriptor>& methods, const std::vector<ValueDescriptor>& values)
+			TypeDescriptor(const std::string& name, const std::type_info& typeInfo, typehash_t hash, const TypeParent& parent, const OptionalConstructorDescriptor& constructor, const std::vector<MemberDescriptor>& members, const std::vector<MethodDescriptor>& methods, const std::vector<ValueDescriptor>& values, const TypeStorage& storage = TypeStorage())
 				: _name(name)
 				, _typeInfo(typeInfo)
 				, _hash(hash)
-				, _parent(parent)
+				, _storage(storage)
+				, _parentLink(parent)
+				, _parent(nullptr)
 				, _constructor(constructor)
 				, _members(members)
 				, _methods(methods)
 				, _values(values)
-			{ }
+			{
+				Flatten();
+			}
 
 			const std::type_info& GetInfo() const
 			{
 				return _typeInfo;
 			}
 
-			const std::string GetName() const
+			const std::string& GetName() const
 			{
 				return _name;
 			}
@@ -60,6 +68,57 @@ namespace Reflecto
 				return _hash;
 			}
 
+			// Unknown, all zero, for descriptors not built from a C++ type
+			const TypeStorage& GetStorage() const
+			{
+				return _storage;
+			}
+
+			// Borrowed from the type library, resolved when the library is built
+			const TypeDescriptor* GetParent() const
+			{
+				return _parent;
+			}
+
+			typehash_t GetParentHash() const
+			{
+				return _parentLink.hash;
+			}
+
+			bool HasParent() const
+			{
+				return _parentLink.hash != kNoParent;
+			}
+
+			// Resolves references to other types from their hashes. Returns false when a
+			// parent or member type cannot be resolved. Flatten must be called once every
+			// type of the library is linked. Only TypeLibraryFactory links, on the copies it
+			// builds a library from, as links are borrowed from that library.
+			template<typename resolver_t>
+			bool Link(const resolver_t& resolve)
+			{
+				bool success = true;
+				if (HasParent())
+				{
+					_parent = resolve(_parentLink.hash);
+					success &= _parent != nullptr;
+				}
+				for (MemberDescriptor& member : _members)
+				{
+					member.Link(resolve(member.GetTypeHash()));
+					success &= member.GetType() != nullptr;
+				}
+				for (MethodDescriptor& method : _methods)
+				{
+					method.Link(resolve);
+				}
+				for (ValueDescriptor& value : _values)
+				{
+					value.Link(resolve(value.GetTypeHash()));
+				}
+				return success;
+			}
+
 			template<typename object_t>
 			bool Is() const
 			{
@@ -76,19 +135,10 @@ namespace Reflecto
 				return _members;
 			}
 
-			std::vector<MemberDescriptor> FetchMemberResursive() const
+			// Members of the whole parent chain, parents first, with offsets relative to this type
+			const std::vector<MemberDescriptor>& FetchMemberResursive() const
 			{
-				std::vector<MemberDescriptor> memberRecursive;
-
-				if (_parent)
-				{
-					std::vector<MemberDescriptor> parentMembers = _parent->FetchMemberResursive();
-					memberRecursive.insert(memberRecursive.end(), parentMembers.begin(), parentMembers.end());
-				}
-
-				memberRecursive.insert(memberRecursive.end(), _members.begin(), _members.end());
-
-				return memberRecursive;
+				return _flattenedMembers;
 			}
 
 			const MemberDescriptor* GetMemberByName(const std::string& name) const
@@ -100,21 +150,9 @@ namespace Reflecto
 				return found != _members.end() ? &(*found) : nullptr;
 			}
 
-			const MemberDescriptor* GetMemberByNameRecursive(const std::string& name) const
+			const MemberDescriptor* GetMemberByNameRecursive(std::string_view name) const
 			{
-				const MemberDescriptor* member = nullptr;
-
-				if (_parent)
-				{
-					member = _parent->GetMemberByNameRecursive(name);
-				}
-
-				if (!member)
-				{
-					member = GetMemberByName(name);
-				}
-
-				return member;
+				return _flattenedMemberIndex.Find(_flattenedMembers, name);
 			}
 
 			const std::vector<MethodDescriptor>& GetMethods() const
@@ -131,21 +169,43 @@ namespace Reflecto
 				return found != _methods.end() ? &(*found) : nullptr;
 			}
 
-			const MethodDescriptor* GetMethodByNameRecursive(const std::string& name) const
+			const MethodDescriptor* GetMethodByNameRecursive(std::string_view name) const
 			{
-				const MethodDescriptor* method = nullptr;
+				return _flattenedMethodIndex.Find(_flattenedMethods, name);
+			}
+
+			// Precomputes the members and methods of the whole parent chain
+			void Flatten()
+			{
+				_flattenedMembers.clear();
+				_flattenedMethods.clear();
 
-				if (_parent)
+				// Parents are reached through the path of their offsets and casts from this type
+				std::vector<std::pair<const TypeDescriptor*, std::vector<SubobjectStep>>> chain;
+				std::vector<SubobjectStep> basePath;
+				for (const TypeDescriptor* type = this; type; type = type->_parent)
 				{
-					method = _parent->GetMethodByNameRecursive(name);
+					chain.emplace_back(type, basePath);
+					if (type->_parent)
+					{
+						const TypeParent& parent = type->_parentLink;
+						TypeExt::AppendSubobjectStep(basePath, parent.offset != kNoOffset ? SubobjectStep{ parent.offset, nullptr } : SubobjectStep{ 0, parent.cast });
+					}
 				}
 
-				if (!method)
+				// Parents first, so their members win over shadowing ones as with a chain walk
+				for (auto link = chain.rbegin(); link != chain.rend(); ++link)
 				{
-					method = GetMethodByName(name);
+					const auto& [linkType, linkPath] = *link;
+					for (const MemberDescriptor& member : linkType->_members)
+					{
+						_flattenedMembers.push_back(member.Rebase(linkPath));
+					}
+					_flattenedMethods.insert(_flattenedMethods.end(), linkType->_methods.begin(), linkType->_methods.end());
 				}
 
-				return method;
+				_flattenedMemberIndex = NameIndex<MemberDescriptor>(_flattenedMembers);
+				_flattenedMethodIndex = NameIndex<MethodDescriptor>(_flattenedMethods);
 			}
 
 			const std::vector<ValueDescriptor>& GetValues() const
@@ -183,15 +243,24 @@ namespace Reflecto
 			}
 
 		private:
+			static constexpr typehash_t kNoParent = 0;
+
 			std::string _name;
 			const std::type_info& _typeInfo;
 			typehash_t _hash;
+			TypeStorage _storage;
 
-			TypeDescriptorPtr _parent;
+			TypeParent _parentLink;
+			const TypeDescriptor* _parent;
 			OptionalConstructorDescriptor _constructor;
 			std::vector<MemberDescriptor> _members;
 			std::vector<MethodDescriptor> _methods;
 			std::vector<ValueDescriptor> _values;
+
+			std::vector<MemberDescriptor> _flattenedMembers;
+			std::vector<MethodDescriptor> _flattenedMethods;
+			NameIndex<MemberDescriptor> _flattenedMemberIndex;
+			NameIndex<MethodDescriptor> _flattenedMethodIndex;
 		};
 	}
 }
\ No newline at end of file
@@ -11,9 +11,8 @@
 #include "TypeDescriptor.h"
 #include "TypeExt.h"
 
-#include "Type/TypeLibrary.h"
-
 #include <memory>
+#include <type_traits>
 
 
 namespace Reflecto
@@ -26,28 +25,33 @@ namespace Reflecto
 		class TypeDescriptorFactory
 		{
 		public:
-			TypeDescriptorFactory(const TypeLibrary& typeLibrary, const std::string& name)
-				: TypeDescriptorFactory(typeLibrary, name, TypeDescriptorPtr())
+			TypeDescriptorFactory(const std::string& name)
+				: _name(name)
+				, _typeInfo(TypeExt::GetTypeInfo<object_t>())
+				, _hash(TypeExt::GetTypeHash<object_t>())
+				, _constructor(BuildConstructor())
 			{
 
 			}
 
-			TypeDescriptorFactory(const TypeLibrary& typeLibrary, const std::string& name, const TypeDescriptorPtr& parent)
-				: _typeLibrary(typeLibrary)
-				, _name(name)
-				, _typeInfo(TypeExt::GetTypeInfo<object_t>())
-				, _hash(TypeExt::GetTypeHash<object_t>())
-				, _sampleObj()
-				, _parent(parent)
-				, _constructor(ConstructorDescriptorFactory<object_t>().Build())
+			// The parent is referred to by hash and resolved when the library is built
+			template <typename parent_t>
+			TypeDescriptorFactory& RegisterParent()
 			{
+				_parent = TypeParent{ TypeExt::GetTypeHash<parent_t>(), kNoOffset, &TypeExt::CastToParent<object_t, parent_t> };
+				if constexpr (TypeExt::IsFixedSubobject<object_t, parent_t>())
+				{
+					const object_t* sample = GetSample();
+					_parent.offset = sample ? TypeExt::ComputeParentOffset<parent_t>(*sample) : kNoOffset;
+				}
 
+				return *this;
 			}
 
-			template <typename member_t, typename object_t>
-			TypeDescriptorFactory& RegisterMember(typename member_t typename object_t::* memberPointer, const std::string& memberName)
+			template <typename member_t, typename owner_t>
+			TypeDescriptorFactory& RegisterMember(typename member_t typename owner_t::* memberPointer, const std::string& memberName)
 			{
-				MemberDescriptor member = MemberDescriptorFactory<object_t, member_t>(_typeLibrary, _sampleObj, memberPointer, memberName).Build();
+				MemberDescriptor member = MemberDescriptorFactory<object_t, member_t>(memberPointer, memberName, GetSample()).Build();
 
 				_members.push_back(member);
 
@@ -64,7 +68,7 @@ namespace Reflecto
 			template <typename object_t, typename return_t, typename ... args_t>
 			TypeDescriptorFactory& RegisterMethod(return_t(object_t::* methodPointer)(args_t ...), const std::string& methodName, const std::vector<std::string>& parameterNames)
 			{
-				MethodDescriptor method = MethodDescriptorFactory<object_t, return_t, args_t ...>(_typeLibrary, _sampleObj, methodPointer, methodName, parameterNames).Build();
+				MethodDescriptor method = MethodDescriptorFactory<object_t, return_t, args_t ...>(methodPointer, methodName, parameterNames).Build();
 
 				_methods.push_back(method);
 
@@ -74,7 +78,7 @@ namespace Reflecto
 			template <typename enum_t>
 			TypeDescriptorFactory& RegisterValue(const enum_t& enumValue, const std::string& valueName)
 			{
-				ValueDescriptor value = ValueDescriptorFactory<enum_t>(_typeLibrary, enumValue, valueName).Build();
+				ValueDescriptor value = ValueDescriptorFactory<enum_t>(enumValue, valueName).Build();
 
 				_values.push_back(value);
 
@@ -83,19 +87,42 @@ namespace Reflecto
 
 			TypeDescriptorUniquePtr Build()
 			{
-				return std::make_unique<TypeDescriptor>(_name, _typeInfo, _hash, _parent, _constructor, _members, _methods, _values);
+				return std::make_unique<TypeDescriptor>(_name, _typeInfo, _hash, _parent, _constructor, _members, _methods, _values, TypeExt::GetTypeStorage<object_t>());
 			}
 
 		private:
-			TypeLibrary _typeLibrary;
-			object_t _sampleObj;
+			// Built once per type, only for types that can be sampled
+			const object_t* GetSample()
+			{
+				if constexpr (TypeExt::CanSample<object_t>())
+				{
+					if (!_sample)
+					{
+						_sample = std::make_shared<object_t>();
+					}
+				}
+				return _sample.get();
+			}
+
+			static OptionalConstructorDescriptor BuildConstructor()
+			{
+				OptionalConstructorDescriptor constructor;
+				// Instances are held in std::any, which requires a copyable type
+				if constexpr (std::is_default_constructible_v<object_t> && std::is_copy_constructible_v<object_t>)
+				{
+					constructor = ConstructorDescriptorFactory<object_t>().Build();
+				}
+				return constructor;
+			}
 
 			std::string _name;
 			const std::type_info& _typeInfo;
 			typehash_t _hash;
 			
-			TypeDescriptorPtr _parent;
-			ConstructorDescriptor _constructor;
+			TypeParent _parent;
+			// Shared so that factories stay copyable
+			std::shared_ptr<const object_t> _sample;
+			OptionalConstructorDescriptor _constructor;
 			std::vector<MemberDescriptor> _members;
 			std::vector<MethodDescriptor> _methods;
 			std::vector<ValueDescriptor> _values;
@@ -2,8 +2,13 @@
 
 #include "Common/Definitions.h"
 
+#include <cstring>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <typeinfo>
+#include <vector>
 
 namespace Reflecto
 {
@@ -11,6 +16,46 @@ namespace Reflecto
 	{
 		using typehash_t = uint64_t;
 
+		// How instances of a type are laid out in memory
+		struct TypeStorage
+		{
+			size_t size = 0;
+			size_t alignment = 0;
+			// Instances can be copied as raw bytes
+			bool triviallyCopyable = false;
+		};
+
+		// Offset of a member or parent that is not at the same place in every instance, such as
+		// one in a virtual base, or of a type that cannot be sampled
+		constexpr uint32_t kNoOffset = std::numeric_limits<uint32_t>::max();
+
+		// Address of a parent subobject from the address of the object holding it
+		using parent_cast_t = const void* (*)(const void* object);
+
+		// Where the parent subobject of a type is: at an offset for non-virtual parents of types
+		// that can be sampled, reached through a cast otherwise
+		struct TypeParent
+		{
+			typehash_t hash = 0;
+			uint32_t offset = 0;
+			parent_cast_t cast = nullptr;
+		};
+
+		// Step from an object to one of its subobjects: the address moves by offset, then goes
+		// through cast when there is one
+		struct SubobjectStep
+		{
+			uint32_t offset = 0;
+			parent_cast_t cast = nullptr;
+		};
+
+		// Member pointer kept as raw bytes, applied by a function instantiated for its type
+		struct MemberPointerAccess
+		{
+			const void* (*apply)(const void* object, const void* memberPointer) = nullptr;
+			alignas(8) byte memberPointer[16] = {};
+		};
+
 		namespace TypeExt
 		{
 			template <typename type>
@@ -32,34 +77,153 @@ namespace Reflecto
 				return GetClassName(GetTypeInfo<type>());
 			}
 
-			inline typehash_t GetTypeHash(const std::type_info& typeinfo)
+			// 64 bits FNV-1a, usable at compile time
+			constexpr typehash_t HashTypeName(std::string_view name)
 			{
-				return typeinfo.hash_code();
+				typehash_t hash = 0xcbf29ce484222325ull;
+				for (size_t i = 0; i < name.size(); ++i)
+				{
+					hash ^= static_cast<uint8_t>(name[i]);
+					hash *= 0x100000001b3ull;
+				}
+				return hash;
 			}
 
 			template <typename type>
-			typehash_t GetTypeHash()
+			constexpr std::string_view GetTypeSignature()
 			{
-				return GetTypeHash(GetTypeInfo<type>());
+#if defined(_MSC_VER)
+				// e.g. "... GetTypeSignature<class std::basic_string<...> >(void)"
+				constexpr std::string_view signature = __FUNCSIG__;
+				constexpr std::string_view prefix = "GetTypeSignature<";
+				constexpr std::string_view suffix = ">(void)";
+				constexpr size_t begin = signature.find(prefix) + prefix.size();
+				constexpr size_t end = signature.rfind(suffix);
+#else
+				// e.g. "... GetTypeSignature() [with type = std::__cxx11::basic_string<char>; ...]", the type
+				// runs up to the next declaration or the closing bracket, array types holding brackets too
+				constexpr std::string_view signature = __PRETTY_FUNCTION__;
+				constexpr std::string_view prefix = "type = ";
+				constexpr size_t begin = signature.find(prefix) + prefix.size();
+				constexpr size_t separator = signature.find(';', begin);
+				constexpr size_t end = separator != std::string_view::npos ? separator : signature.rfind(']');
+#endif
+				return signature.substr(begin, end - begin);
 			}
 
-			template<typename object_t, typename member_pointer_owning_t, typename member_t>
-			byte ComputeMemberOffset(const object_t& sampleObj, member_t typename member_pointer_owning_t::* memberPointer)
+			// Identifier of a type, computed at compile time from the compiler's spelling of the type.
+			// Identifiers are stable from one process or build to the next as long as the compiler is the same.
+			// Use REFLECTO_TYPE_ID to pin the identifier of a type on an explicit name, which also makes
+			// it stable across compilers (e.g. for identifiers persisted in binary streams).
+			template <typename type>
+			struct TypeId
 			{
-				const byte* dummyAddr = reinterpret_cast<const byte*>(&sampleObj);
-				const byte* memberAddr = reinterpret_cast<const byte*>(&(sampleObj.*memberPointer));
-				const byte offset = static_cast<byte>(memberAddr - dummyAddr);
-				return offset;
+				static constexpr typehash_t value = HashTypeName(GetTypeSignature<type>());
+			};
+
+			template <typename type>
+			constexpr typehash_t GetTypeHash()
+			{
+				// Same identity as typeid: top level qualifiers and references are ignored
+				return TypeId<std::remove_cv_t<std::remove_reference_t<type>>>::value;
+			}
+
+			template <typename type>
+			constexpr TypeStorage GetTypeStorage()
+			{
+				return TypeStorage{ sizeof(type), alignof(type), std::is_trivially_copyable_v<type> };
+			}
+
+			// Offsets of the members and parents of types that can be sampled are measured once on a
+			// sample object, member pointers only apply to a live one
+			template<typename object_t>
+			constexpr bool CanSample()
+			{
+				return std::is_default_constructible_v<object_t>;
+			}
+
+			// Members of object_t and of its non-virtual parents are at the same offset in every
+			// instance, unlike those of virtual parents
+			template<typename object_t, typename owner_t>
+			constexpr bool IsFixedSubobject()
+			{
+				return std::is_convertible_v<char owner_t::*, char object_t::*>;
 			}
 
 			template<typename object_t, typename member_pointer_owning_t, typename member_t>
-			byte ComputeMethodOffset(const object_t& sampleObj, member_t typename member_pointer_owning_t::* memberPointer)
+			uint32_t ComputeMemberOffset(const object_t& object, member_t typename member_pointer_owning_t::* memberPointer)
+			{
+				const byte* objectAddr = reinterpret_cast<const byte*>(&object);
+				const byte* memberAddr = reinterpret_cast<const byte*>(&(object.*memberPointer));
+				return static_cast<uint32_t>(memberAddr - objectAddr);
+			}
+
+			template<typename parent_t, typename object_t>
+			uint32_t ComputeParentOffset(const object_t& object)
+			{
+				const byte* objectAddr = reinterpret_cast<const byte*>(&object);
+				const byte* parentAddr = reinterpret_cast<const byte*>(static_cast<const parent_t*>(&object));
+				return static_cast<uint32_t>(parentAddr - objectAddr);
+			}
+
+			template<typename object_t, typename parent_t>
+			const void* CastToParent(const void* object)
+			{
+				return static_cast<const parent_t*>(static_cast<const object_t*>(object));
+			}
+
+			template<typename object_t, typename owner_t, typename member_t>
+			const void* ApplyMemberPointer(const void* object, const void* memberPointer)
 			{
-				const byte* dummyAddr = reinterpret_cast<const byte*>(&sampleObj);
-				const byte* memberAddr = reinterpret_cast<const byte*>(&(sampleObj.*memberPointer));
-				const byte offset = static_cast<byte>(memberAddr - dummyAddr);
-				return offset;
+				member_t owner_t::* pointer;
+				std::memcpy(&pointer, memberPointer, sizeof(pointer));
+				return &(static_cast<const object_t*>(object)->*pointer);
+			}
+
+			template<typename object_t, typename owner_t, typename member_t>
+			MemberPointerAccess GetMemberPointerAccess(member_t owner_t::* memberPointer)
+			{
+				static_assert(sizeof(memberPointer) <= sizeof(MemberPointerAccess::memberPointer), "Member pointer too large to be stored");
+
+				MemberPointerAccess access;
+				access.apply = &ApplyMemberPointer<object_t, owner_t, member_t>;
+				std::memcpy(access.memberPointer, &memberPointer, sizeof(memberPointer));
+				return access;
+			}
+
+			// Offsets before a cast are folded into its step
+			inline void AppendSubobjectStep(std::vector<SubobjectStep>& path, const SubobjectStep& step)
+			{
+				if (!path.empty() && !path.back().cast)
+				{
+					path.back().offset += step.offset;
+					path.back().cast = step.cast;
+				}
+				else
+				{
+					path.push_back(step);
+				}
+			}
+
+			inline const void* ResolveSubobjectPath(const void* object, const std::vector<SubobjectStep>& path)
+			{
+				const void* subobject = object;
+				for (const SubobjectStep& step : path)
+				{
+					subobject = reinterpret_cast<const byte*>(subobject) + step.offset;
+					subobject = step.cast ? step.cast(subobject) : subobject;
+				}
+				return subobject;
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+// Pins the identifier of a type on an explicit name. Must be used from the global namespace.
+#define REFLECTO_TYPE_ID(type, name)												\
+	template <>																		\
+	struct Reflecto::Reflection::TypeExt::TypeId<type>								\
+	{																				\
+		static constexpr Reflecto::Reflection::typehash_t value =					\
+			Reflecto::Reflection::TypeExt::HashTypeName(name);						\
+	};
@@ -2,8 +2,11 @@
 
 #include "Type/TypeDescriptor.h"
 #include "Type/TypeExt.h"
+#include "Type/TypeLibraryIndex.h"
+#include "Type/TypeLibraryLayout.h"
 
 #include <map>
+#include <string_view>
 #include <vector>
 
 namespace Reflecto
@@ -17,8 +20,10 @@ namespace Reflecto
 		public:
 			TypeLibrary(const std::vector<TypeDescriptorPtr>& typeDescriptors)
 				: _typeDescriptors(typeDescriptors)
+				, _index(_typeDescriptors)
+				, _layout(_typeDescriptors, _index)
 			{ }
-			
+
 			template<class value_t>
 			TypeDescriptorPtr GetDescriptor() const
 			{
@@ -27,24 +32,68 @@ namespace Reflecto
 
 			const TypeDescriptorPtr GetDescriptorByHash(const typehash_t& hash) const
 			{
-				std::vector<TypeDescriptorPtr>::const_iterator found = std::find_if(begin(_typeDescriptors), end(_typeDescriptors), [&](const auto& type) { return type->GetHash() == hash; });
+				return GetDescriptorAt(_index.FindByHash(hash));
+			}
+
+			const TypeDescriptorPtr GetDescriptorByName(std::string_view name) const
+			{
+				return GetDescriptorAt(_index.FindByName(name));
+			}
+
+			// Borrowed lookups, valid for as long as the library is. Unlike the
+			// owning variants, they never touch the descriptor reference count.
+			template<class value_t>
+			const TypeDescriptor* FindDescriptor() const
+			{
+				return FindDescriptorByHash(TypeExt::GetTypeHash<value_t>());
+			}
+
+			const TypeDescriptor* FindDescriptorByHash(typehash_t hash) const
+			{
+				return FindDescriptorAt(_index.FindByHash(hash));
+			}
+
+			const TypeDescriptor* FindDescriptorByName(std::string_view name) const
+			{
+				return FindDescriptorAt(_index.FindByName(name));
+			}
 
-				TypeDescriptorPtr type = found != _typeDescriptors.end() ? (*found) : nullptr;
+			// Positions of types in the library, stable for its lifetime
+			uint32_t GetTypeIndex(typehash_t hash) const
+			{
+				return _index.FindByHash(hash);
+			}
 
-				return type;
+			template<class value_t>
+			uint32_t GetTypeIndex() const
+			{
+				return GetTypeIndex(TypeExt::GetTypeHash<value_t>());
 			}
 
-			const TypeDescriptorPtr GetDescriptorByName(const std::string& name) const
+			const TypeDescriptor* FindDescriptorAt(uint32_t typeIndex) const
 			{
-				std::vector<TypeDescriptorPtr>::const_iterator found = std::find_if(begin(_typeDescriptors), end(_typeDescriptors), [&](const auto& type) { return type->GetName() == name; });
+				return typeIndex < _typeDescriptors.size() ? _typeDescriptors[typeIndex].get() : nullptr;
+			}
 
-				TypeDescriptorPtr type = found != _typeDescriptors.end() ? (*found) : nullptr;
+			const TypeLibraryLayout& GetLayout() const
+			{
+				return _layout;
+			}
 
-				return type;
+			const std::vector<TypeDescriptorPtr>& GetDescriptors() const
+			{
+				return _typeDescriptors;
 			}
 
 		private:
+			TypeDescriptorPtr GetDescriptorAt(uint32_t position) const
+			{
+				return position < _typeDescriptors.size() ? _typeDescriptors[position] : nullptr;
+			}
+
 			std::vector<TypeDescriptorPtr> _typeDescriptors;
+			TypeLibraryIndex _index;
+			TypeLibraryLayout _layout;
 		};
 	}
-}
\ No newline at end of file
+}
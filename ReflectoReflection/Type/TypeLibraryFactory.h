@@ -3,9 +3,10 @@
 #include "TypeDescriptorFactory.h"
 #include "TypeLibrary.h"
 
-#include <algorithm>
+#include <any>
 #include <assert.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -13,13 +14,15 @@ namespace Reflecto
 {
 	namespace Reflection
 	{
+		// Collects type descriptors in any order. References between types are kept as
+		// hashes until Build links them, so a type may refer to one registered after it.
 		class TypeLibraryFactory
 		{
 		public:
 			template<class value_t>
 			TypeLibraryFactory& Add(const std::string& typeName)
 			{
-				TypeDescriptorFactory<value_t> typeFactory = TypeDescriptorFactory<value_t>(Build(), typeName);
+				TypeDescriptorFactory<value_t> typeFactory = TypeDescriptorFactory<value_t>(typeName);
 				Add(typeFactory.Build());
 				return *this;
 			}
@@ -27,13 +30,8 @@ namespace Reflecto
 			template<class value_t, class parent_value_t>
 			TypeLibraryFactory& Add(const std::string& typeName)
 			{
-				const TypeLibrary typeLibrary = Build();
-				TypeDescriptorPtr parentTypeDescriptor = typeLibrary.GetDescriptor<parent_value_t>();
-				if (ensure(parentTypeDescriptor))
-				{
-					TypeDescriptorFactory<value_t> typeFactory = TypeDescriptorFactory<value_t>(typeLibrary, typeName, parentTypeDescriptor);
-					Add(typeFactory.Build());
-				}
+				TypeDescriptorFactory<value_t> typeFactory = TypeDescriptorFactory<value_t>(typeName).RegisterParent<parent_value_t>();
+				Add(typeFactory.Build());
 				return *this;
 			}
 
@@ -45,23 +43,42 @@ namespace Reflecto
 				return *this;
 			}
 
+			// Adds a descriptor built elsewhere, which may be shared. Build links a copy of it.
+			TypeLibraryFactory& Add(const TypeDescriptorPtr& type)
+			{
+				if (ensure(type))
+				{
+					const auto inserted = _typePositions.insert({ type->GetHash(), _typeDescriptors.size() });
+					if (inserted.second)
+					{
+						_typeDescriptors.push_back(type);
+					}
+					else if (_typeDescriptors[inserted.first->second]->GetInfo() != type->GetInfo())
+					{
+						// Same identifier for two distinct types means the type names collided, the
+						// first type is kept and Build fails
+						_collided = true;
+					}
+				}
+				return *this;
+			}
+
+			TypeLibraryFactory& Add(TypeDescriptorUniquePtr&& type)
+			{
+				return Add(TypeDescriptorPtr(std::move(type)));
+			}
+
 			template<class value_t>
 			TypeLibraryFactory& BeginType(const std::string& typeName)
 			{
-				const TypeLibrary typeLibrary = Build();
-				_currentTypeFactory = TypeDescriptorFactory<value_t>(typeLibrary, typeName);
+				_currentTypeFactory = TypeDescriptorFactory<value_t>(typeName);
 				return *this;
 			}
 
 			template<class value_t, class parent_value_t>
 			TypeLibraryFactory& BeginType(const std::string& typeName)
 			{
-				const TypeLibrary typeLibrary = Build();
-				TypeDescriptorPtr parentTypeDescriptor = typeLibrary.GetDescriptor<parent_value_t>();
-				if (ensure(parentTypeDescriptor))
-				{
-					_currentTypeFactory = TypeDescriptorFactory<value_t>(typeLibrary, typeName, parentTypeDescriptor);
-				}
+				_currentTypeFactory = TypeDescriptorFactory<value_t>(typeName).RegisterParent<parent_value_t>();
 				return *this;
 			}
 
@@ -121,9 +138,31 @@ namespace Reflecto
 				return *this;
 			}
 
+			// Descriptors are linked before the library shares them, so that each is linked once
+			// and only to types of its own library. Those held elsewhere, added from outside or
+			// already part of a library built before, are copied first and left unlinked. Links
+			// are borrowed: they stay valid for as long as the library, or a copy of it, is alive,
+			// and a descriptor kept past that must not follow them.
 			TypeLibrary Build()
 			{
-				return TypeLibrary(_typeDescriptors);
+				bool success = false;
+				TypeLibrary library = Build(success);
+				ensure(success);
+				return library;
+			}
+
+			// Fails when two types share an identifier or when a parent or member type is not
+			// registered. The library is still built from the types that could be added.
+			TypeLibrary Build(bool& success)
+			{
+				std::vector<TypeDescriptorPtr> typeDescriptors;
+				typeDescriptors.reserve(_typeDescriptors.size());
+				for (const TypeDescriptorPtr& type : _typeDescriptors)
+				{
+					typeDescriptors.push_back(type.use_count() == 1 ? type : std::make_shared<TypeDescriptor>(*type));
+				}
+				success = Link(typeDescriptors) && !_collided;
+				return TypeLibrary(typeDescriptors);
 			}
 
 		private:
@@ -134,18 +173,32 @@ namespace Reflecto
 				return std::any_cast<TypeDescriptorFactory<value_t>>(&_currentTypeFactory);
 			}
 
-			TypeLibraryFactory& Add(TypeDescriptorUniquePtr&& type)
+			bool Link(const std::vector<TypeDescriptorPtr>& typeDescriptors) const
 			{
-				TypeDescriptorPtr sharedType = std::move(type);
-				if (std::find(_typeDescriptors.begin(), _typeDescriptors.end(), sharedType) == _typeDescriptors.end())
+				bool success = true;
+				const auto resolve = [&](typehash_t hash) -> const TypeDescriptor* {
+					const auto found = _typePositions.find(hash);
+					return found != _typePositions.end() ? typeDescriptors[found->second].get() : nullptr;
+				};
+
+				for (const TypeDescriptorPtr& type : typeDescriptors)
 				{
-					_typeDescriptors.push_back(sharedType);
+					// Parent and member types must be registered, method and value types are optional
+					success &= type->Link(resolve);
 				}
-				return *this;
+
+				// Parents may be linked after their children, so flatten once every link is resolved
+				for (const TypeDescriptorPtr& type : typeDescriptors)
+				{
+					type->Flatten();
+				}
+				return success;
 			}
 
 			std::any _currentTypeFactory;
 			std::vector<TypeDescriptorPtr> _typeDescriptors;
+			std::unordered_map<typehash_t, size_t> _typePositions;
+			bool _collided = false;
 		};
 	}
 }
\ No newline at end of file
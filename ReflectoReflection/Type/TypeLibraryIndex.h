@@ -0,0 +1,150 @@
+#pragma once
+
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeExt.h"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		// Open addressing (linear probing) index over a type descriptor collection.
+		// Built once from the descriptors and never modified afterwards.
+		class TypeLibraryIndex
+		{
+		public:
+			static constexpr uint32_t kInvalidPosition = std::numeric_limits<uint32_t>::max();
+
+			TypeLibraryIndex()
+				: _mask(0)
+			{ }
+
+			TypeLibraryIndex(const std::vector<TypeDescriptorPtr>& typeDescriptors)
+				: _mask(ComputeCapacity(typeDescriptors.size()) - 1)
+				, _hashSlots(_mask + 1)
+				, _nameSlots(_mask + 1)
+			{
+				for (uint32_t position = 0; position < typeDescriptors.size(); ++position)
+				{
+					const TypeDescriptorPtr& type = typeDescriptors[position];
+					if (type)
+					{
+						InsertHash(type->GetHash(), position);
+						InsertName(type->GetName(), position);
+					}
+				}
+			}
+
+			uint32_t FindByHash(typehash_t hash) const
+			{
+				uint32_t position = kInvalidPosition;
+				if (!_hashSlots.empty())
+				{
+					for (size_t slot = GetSlot(hash); _hashSlots[slot].position != kInvalidPosition; slot = (slot + 1) & _mask)
+					{
+						if (_hashSlots[slot].hash == hash)
+						{
+							position = _hashSlots[slot].position;
+							break;
+						}
+					}
+				}
+				return position;
+			}
+
+			uint32_t FindByName(std::string_view name) const
+			{
+				uint32_t position = kInvalidPosition;
+				if (!_nameSlots.empty())
+				{
+					const size_t nameHash = HashName(name);
+					for (size_t slot = GetSlot(nameHash); _nameSlots[slot].position != kInvalidPosition; slot = (slot + 1) & _mask)
+					{
+						if (_nameSlots[slot].nameHash == nameHash && _nameSlots[slot].name == name)
+						{
+							position = _nameSlots[slot].position;
+							break;
+						}
+					}
+				}
+				return position;
+			}
+
+		private:
+			struct HashSlot
+			{
+				typehash_t hash = 0;
+				uint32_t position = kInvalidPosition;
+			};
+
+			struct NameSlot
+			{
+				size_t nameHash = 0;
+				std::string_view name;
+				uint32_t position = kInvalidPosition;
+			};
+
+			static size_t ComputeCapacity(size_t count)
+			{
+				// Keep load factor at or below 50% so probe sequences stay short
+				size_t capacity = 8;
+				while (capacity < count * 2)
+				{
+					capacity <<= 1;
+				}
+				return capacity;
+			}
+
+			static size_t HashName(std::string_view name)
+			{
+				return std::hash<std::string_view>()(name);
+			}
+
+			size_t GetSlot(uint64_t hash) const
+			{
+				// Fibonacci hashing spreads low entropy hashes over the whole table
+				return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> 32) & _mask;
+			}
+
+			void InsertHash(typehash_t hash, uint32_t position)
+			{
+				size_t slot = GetSlot(hash);
+				while (_hashSlots[slot].position != kInvalidPosition)
+				{
+					if (_hashSlots[slot].hash == hash)
+					{
+						// First registered type wins, as with a linear search
+						return;
+					}
+					slot = (slot + 1) & _mask;
+				}
+				_hashSlots[slot] = HashSlot{ hash, position };
+			}
+
+			void InsertName(std::string_view name, uint32_t position)
+			{
+				const size_t nameHash = HashName(name);
+				size_t slot = GetSlot(nameHash);
+				while (_nameSlots[slot].position != kInvalidPosition)
+				{
+					if (_nameSlots[slot].nameHash == nameHash && _nameSlots[slot].name == name)
+					{
+						return;
+					}
+					slot = (slot + 1) & _mask;
+				}
+				_nameSlots[slot] = NameSlot{ nameHash, name, position };
+			}
+
+			size_t _mask;
+			std::vector<HashSlot> _hashSlots;
+			std::vector<NameSlot> _nameSlots;
+		};
+	}
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Type/MemberDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibraryIndex.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		enum class TypeKind : uint8_t
+		{
+			Value,
+			Object,
+			Enum
+		};
+
+		// Hot data of a type, kept small so walking a type touches few cache lines
+		struct TypeLayout
+		{
+			uint32_t firstMember = 0;
+			uint32_t memberCount = 0;
+			uint32_t parentIndex = TypeLibraryIndex::kInvalidPosition;
+			TypeKind kind = TypeKind::Value;
+		};
+
+		struct MemberLayout
+		{
+			// kNoOffset for members reached through their descriptor
+			uint32_t offset = 0;
+			uint32_t typeIndex = TypeLibraryIndex::kInvalidPosition;
+		};
+
+		class MemberLayoutRange
+		{
+		public:
+			MemberLayoutRange(const MemberLayout* begin, const MemberLayout* end)
+				: _begin(begin)
+				, _end(end)
+			{ }
+
+			const MemberLayout* begin() const
+			{
+				return _begin;
+			}
+
+			const MemberLayout* end() const
+			{
+				return _end;
+			}
+
+			size_t size() const
+			{
+				return _end - _begin;
+			}
+
+		private:
+			const MemberLayout* _begin;
+			const MemberLayout* _end;
+		};
+
+		// Contiguous snapshot of a type descriptor collection. Types and members refer to
+		// each other by position in the collection; names and other cold data stay in the
+		// descriptors and are reached through the same positions. Descriptors are shared
+		// between library copies, so a copied layout still points at live cold data.
+		class TypeLibraryLayout
+		{
+		public:
+			TypeLibraryLayout() = default;
+
+			TypeLibraryLayout(const std::vector<TypeDescriptorPtr>& typeDescriptors, const TypeLibraryIndex& index)
+			{
+				_types.reserve(typeDescriptors.size());
+				for (const TypeDescriptorPtr& type : typeDescriptors)
+				{
+					TypeLayout typeLayout;
+					typeLayout.firstMember = static_cast<uint32_t>(_members.size());
+					if (type)
+					{
+						typeLayout.kind = ComputeKind(*type);
+						typeLayout.parentIndex = type->HasParent() ? index.FindByHash(type->GetParentHash()) : TypeLibraryIndex::kInvalidPosition;
+						for (const MemberDescriptor& member : type->GetMembers())
+						{
+							_members.push_back(MemberLayout{ member.GetOffset(), index.FindByHash(member.GetTypeHash()) });
+							_memberDescriptors.push_back(&member);
+						}
+					}
+					typeLayout.memberCount = static_cast<uint32_t>(_members.size()) - typeLayout.firstMember;
+					_types.push_back(typeLayout);
+				}
+			}
+
+			const TypeLayout& GetType(uint32_t typeIndex) const
+			{
+				return _types[typeIndex];
+			}
+
+			MemberLayoutRange GetMembers(uint32_t typeIndex) const
+			{
+				const TypeLayout& type = _types[typeIndex];
+				const MemberLayout* first = _members.data() + type.firstMember;
+				return MemberLayoutRange(first, first + type.memberCount);
+			}
+
+			// Cold counterpart of a member layout, for its name or anything not needed on hot paths
+			const MemberDescriptor& GetMemberDescriptor(const MemberLayout& member) const
+			{
+				return *_memberDescriptors[&member - _members.data()];
+			}
+
+			const void* ResolveMember(const MemberLayout& member, const void* object) const
+			{
+				return member.offset != kNoOffset ? static_cast<const byte*>(object) + member.offset : GetMemberDescriptor(member).ResolveMember(object);
+			}
+
+		private:
+			static TypeKind ComputeKind(const TypeDescriptor& type)
+			{
+				TypeKind kind = TypeKind::Value;
+				if (!type.GetValues().empty())
+				{
+					kind = TypeKind::Enum;
+				}
+				else if (!type.GetMembers().empty() || type.HasParent())
+				{
+					kind = TypeKind::Object;
+				}
+				return kind;
+			}
+
+			std::vector<TypeLayout> _types;
+			std::vector<MemberLayout> _members;
+			std::vector<const MemberDescriptor*> _memberDescriptors;
+		};
+	}
+}
@@ -20,19 +20,30 @@ namespace Reflecto
 		public:
 			using underlying_vale_type = uint64_t;
 
-			ValueDescriptor(const TypeDescriptorPtr& type, const std::string& name, underlying_vale_type value)
-				: _type(type)
+			ValueDescriptor(typehash_t typeHash, const std::string& name, underlying_vale_type value)
+				: _typeHash(typeHash)
+				, _type(nullptr)
 				, _name(name)
 				, _underlyingValue(value)
 			{
 
 			}
 
-			const TypeDescriptorPtr& GetType() const
+			const TypeDescriptor* GetType() const
 			{
 				return _type;
 			}
 
+			typehash_t GetTypeHash() const
+			{
+				return _typeHash;
+			}
+
+			void Link(const TypeDescriptor* type)
+			{
+				_type = type;
+			}
+
 			const std::string& GetName() const
 			{
 				return _name;
@@ -51,7 +62,8 @@ namespace Reflecto
 			std::string ToString() const;
 
 		private:
-			TypeDescriptorPtr _type;
+			typehash_t _typeHash;
+			const TypeDescriptor* _type;
 			std::string _name;
 			underlying_vale_type _underlyingValue;
 		};
@@ -1,9 +1,7 @@
 #pragma once
 
 #include "ValueDescriptor.h"
-#include "TypeDescriptor.h"
-#include "TypeDescriptorFactory.h"
-#include "TypeLibrary.h"
+#include "TypeExt.h"
 
 #include <assert.h>
 
@@ -17,21 +15,18 @@ namespace Reflecto
 		public:
 			using enum_underlying_type = std::underlying_type_t<enum_t>;
 
-			ValueDescriptorFactory(const TypeLibrary& typeLibrary, const enum_t& enumValue, const std::string& enumValueName)
-				: _typeLibrary(typeLibrary)
-				, _enum(enumValue)
+			ValueDescriptorFactory(const enum_t& enumValue, const std::string& enumValueName)
+				: _enum(enumValue)
 				, _value(static_cast<enum_underlying_type>(enumValue))
 				, _name(enumValueName)
 			{ }
 
 			ValueDescriptor Build()
 			{
-				const TypeDescriptorPtr type = _typeLibrary.GetDescriptor<enum_t>();
-				return ValueDescriptor(type, _name, _value);
+				return ValueDescriptor(TypeExt::GetTypeHash<enum_t>(), _name, _value);
 			}
 
 		private:
-			TypeLibrary _typeLibrary;
 			enum_t _enum;
 			enum_underlying_type _value;
 			std::string _name;
@@ -5,12 +5,14 @@
 #include "Serialization/SerializerFactory.h"
 #include "Serialization/Strategy/SerializationStrategy.h"
 #include "Serialization/Writer/JsonSerializationWriter.h"
+#include "Type/ReflectedValue.h"
 #include "Type/TypeDescriptor.h"
 #include "Type/TypeDescriptor.h"
 #include "Type/TypeLibrary.h"
 #include "Utils/StringExt.h"
 #include "jsoncpp/json.h"
 
+#include <array>
 #include <string>
 
 namespace Reflecto
@@ -127,30 +129,44 @@ namespace Reflecto
 
 				ensure(parametersDescriptor.size() == param_count);
 
-				MethodDescriptor::weak_resolved_method_t<param_count> method = methodDescriptor.WeakResolveMethod<object_t, param_count>(&instance);
+				InstructionResult result = parameters.size() == param_count ? InstructionResult::Ok : InstructionResult::BadInstruction;
 
-				MethodDescriptor::weak_method_params_t<param_count> weak_parameters;
-
-				if (param_count > 0)
+				// Arguments and result are constructed in place, inline when they fit
+				std::array<ReflectedValue, param_count> arguments;
+				std::array<void*, param_count> argumentAddresses = {};
+				for (size_t i = 0; i < param_count && result == InstructionResult::Ok; ++i)
 				{
-					for (size_t i = 0; i < param_count; ++i)
-					{
-						const ParameterDescriptor& parameterDescriptor = parametersDescriptor[i];
-						const std::string strParameter = parameters[i];
+					const ParameterDescriptor& parameterDescriptor = parametersDescriptor[i];
+					const std::string strParameter = parameters[i];
 
-						Serialization::JsonSerializationReader reader;
-						std::istringstream stream = std::istringstream(strParameter);
-						reader.Import(stream);
+					Serialization::JsonSerializationReader reader;
+					std::istringstream stream = std::istringstream(strParameter);
+					reader.Import(stream);
 
-						std::any anyParameter;
-						serializer.RawDeserialize(parameterDescriptor.GetType(), anyParameter, reader);
+					if (serializer.RawDeserialize(parameterDescriptor.GetType(), arguments[i], reader))
+					{
+						argumentAddresses[i] = arguments[i].GetAddress();
+					}
+					else
+					{
+						result = InstructionResult::UnsupportedType;
+					}
+				}
 
-						weak_parameters[i] = anyParameter;
+				// Method is only invoked once every argument was read
+				if (result == InstructionResult::Ok)
+				{
+					// Methods without a constructible return type are invoked without result
+					ReflectedValue returnValue;
+					const TypeDescriptor* returnType = methodDescriptor.GetReturnType();
+					if (returnType && returnType->GetConstructor())
+					{
+						returnValue.Emplace(returnType);
 					}
+
+					methodDescriptor.Invoke(&instance, argumentAddresses.data(), returnValue.GetAddress());
 				}
-				
-				std::any returnValue = AnyExt::Invoke(method, weak_parameters);
-				return InstructionResult::Ok;
+				return result;
 			}
 
 			InstructionResult ProcessInstruction(const Reflection::TypeLibrary& typeLibrary, const Serialization::Serializer& serializer, object_t& instance, const std::string& instruction)
@@ -248,7 +264,7 @@ namespace Reflecto
 			}
 
 			template<typename stream_t>
-			void WriteValue(const Serialization::Serializer& serializer, const Reflection::TypeDescriptorPtr& type, const void* value, stream_t& ouput)
+			void WriteValue(const Serialization::Serializer& serializer, const Reflection::TypeDescriptor* type, const void* value, stream_t& ouput)
 			{
 				Serialization::JsonSerializationWriter writer;
 
@@ -34,5 +34,7 @@ inline std::wstring Microsoft::VisualStudio::CppUnitTestFramework::ToString<std:
 template<>
 inline std::wstring Microsoft::VisualStudio::CppUnitTestFramework::ToString<std::array<uint32_t, 10>>(const std::array<uint32_t, 10>& a)
 {
-
+	return Reflecto::StringExt::StringifyCollection<std::wstring>(a, [](uint32_t value) {
+		return std::to_wstring(value);
+	});
 }
\ No newline at end of file
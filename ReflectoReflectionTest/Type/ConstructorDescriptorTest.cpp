@@ -0,0 +1,56 @@
+#include "TestCommon.h"
+
+#include "Type/ConstructorDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <memory_resource>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		namespace Test
+		{
+			TEST_CLASS(ConstructorDescriptorTest)
+			{
+			public:
+				TEST_METHOD(NewFromPool)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<std::string>("string")
+					.Build();
+
+					const ConstructorDescriptor& constructor = *testLibrary.FindDescriptor<std::string>()->GetConstructor();
+					std::pmr::unsynchronized_pool_resource pool;
+
+					/////////////
+					// Act
+					void* first = constructor.New(pool);
+					*static_cast<std::string*>(first) = "Pooled";
+					const std::string firstValue = *static_cast<std::string*>(first);
+					constructor.Delete(pool, first);
+
+					void* second = constructor.New(pool);
+					const std::string secondValue = *static_cast<std::string*>(second);
+					constructor.Delete(pool, second);
+
+					/////////////
+					// Assert
+					Assert::AreEqual(sizeof(std::string), constructor.GetSize(), L"Size is unexpected");
+					Assert::AreEqual(alignof(std::string), constructor.GetAlignment(), L"Alignment is unexpected");
+					Assert::AreEqual(std::string("Pooled"), firstValue, L"Constructed value is unexpected");
+					Assert::AreEqual(std::string(), secondValue, L"Value is unexpectedly not default constructed");
+					Assert::IsTrue(first == second, L"Storage is unexpectedly not reused by the pool");
+				}
+			};
+		}
+	}
+}
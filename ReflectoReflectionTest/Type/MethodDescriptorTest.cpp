@@ -0,0 +1,87 @@
+#include "TestCommon.h"
+
+#include "Type/MethodDescriptor.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace
+{
+	class InvocationSample
+	{
+	public:
+		int32_t Add(int32_t left, int32_t right)
+		{
+			return left + right + Bias;
+		}
+
+		void Append(const std::string& suffix)
+		{
+			Text += suffix;
+		}
+
+		int32_t Bias = 0;
+		std::string Text;
+	};
+}
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		namespace Test
+		{
+			TEST_CLASS(MethodDescriptorTest)
+			{
+			public:
+				TEST_METHOD(Invoke)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<void>("void")
+						.Add<int32_t>("int32")
+						.Add<std::string>("string")
+						.BeginType<InvocationSample>("InvocationSample")
+							.RegisterMethod(&InvocationSample::Add, "Add", { "left", "right" })
+							.RegisterMethod(&InvocationSample::Append, "Append", { "suffix" })
+						.EndType<InvocationSample>()
+					.Build();
+
+					const TypeDescriptor* sampleType = testLibrary.FindDescriptor<InvocationSample>();
+					const MethodDescriptor* addMethod = sampleType->GetMethodByName("Add");
+					const MethodDescriptor* appendMethod = sampleType->GetMethodByName("Append");
+
+					InvocationSample instance;
+					instance.Bias = 100;
+					instance.Text = "Hello";
+
+					int32_t left = 2;
+					int32_t right = 3;
+					std::string suffix = " world";
+
+					/////////////
+					// Act
+					int32_t actualSum = 0;
+					void* addArgs[] = { &left, &right };
+					const bool addSuccess = addMethod->Invoke(&instance, addArgs, &actualSum);
+
+					void* appendArgs[] = { &suffix };
+					const bool appendSuccess = appendMethod->Invoke(&instance, appendArgs, nullptr);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(addSuccess && appendSuccess, L"Invocation unexpectedly failed");
+					Assert::AreEqual(105, actualSum, L"Returned value is unexpected");
+					Assert::AreEqual(std::string("Hello world"), instance.Text, L"Side effect is unexpected");
+					Assert::AreEqual(std::string(" world"), suffix, L"Argument passed by reference is unexpectedly modified");
+				}
+			};
+		}
+	}
+}
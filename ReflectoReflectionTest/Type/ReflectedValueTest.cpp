@@ -0,0 +1,131 @@
+#include "TestCommon.h"
+
+#include "Type/ReflectedValue.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <array>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace
+{
+	struct LargeValue
+	{
+		char Buffer[1024] = {};
+		std::string Label = "Large";
+	};
+}
+
+namespace Reflecto
+{
+	namespace Reflection
+	{
+		namespace Test
+		{
+			TEST_CLASS(ReflectedValueTest)
+			{
+			public:
+				TEST_METHOD(EmplaceSmall)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t>("int32")
+					.Build();
+
+					const TypeDescriptor* intType = testLibrary.FindDescriptor<int32_t>();
+
+					/////////////
+					// Act
+					ReflectedValue value;
+					const bool success = value.Emplace(intType);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Emplace unexpectedly failed");
+					Assert::IsTrue(value.IsInline(), L"Small value is unexpectedly stored outside the inline buffer");
+					Assert::IsTrue(value.Get<int32_t>() != nullptr, L"Value is unexpectedly of another type");
+					Assert::AreEqual(0, *value.Get<int32_t>(), L"Value is unexpectedly not default constructed");
+				}
+
+				TEST_METHOD(EmplaceLarge)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<std::string>("string")
+						.BeginType<LargeValue>("LargeValue")
+							.RegisterMember(&LargeValue::Label, "Label")
+						.EndType<LargeValue>()
+					.Build();
+
+					const TypeDescriptor* largeType = testLibrary.FindDescriptor<LargeValue>();
+
+					/////////////
+					// Act
+					ReflectedValue value(largeType);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(value.HasValue(), L"Value is unexpectedly empty");
+					Assert::IsFalse(value.IsInline(), L"Large value is unexpectedly stored in the inline buffer");
+					Assert::AreEqual(std::string("Large"), value.Get<LargeValue>()->Label, L"Value is unexpectedly not default constructed");
+					Assert::IsTrue(value.Get<int32_t>() == nullptr, L"Value is unexpectedly accessible as another type");
+				}
+
+				TEST_METHOD(EmplaceFromResource)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<std::string>("string")
+						.BeginType<LargeValue>("LargeValue")
+							.RegisterMember(&LargeValue::Label, "Label")
+						.EndType<LargeValue>()
+					.Build();
+
+					// Arena that fails instead of falling back to the heap
+					alignas(std::max_align_t) std::array<byte, 4096> arenaBuffer;
+					std::pmr::monotonic_buffer_resource arena(arenaBuffer.data(), arenaBuffer.size(), std::pmr::null_memory_resource());
+
+					/////////////
+					// Act
+					ReflectedValue value(testLibrary.FindDescriptor<LargeValue>(), arena);
+
+					/////////////
+					// Assert
+					const byte* address = static_cast<const byte*>(value.GetAddress());
+					Assert::IsTrue(address >= arenaBuffer.data() && address < arenaBuffer.data() + arenaBuffer.size(), L"Value is unexpectedly allocated outside the arena");
+					Assert::AreEqual(std::string("Large"), value.Get<LargeValue>()->Label, L"Value is unexpectedly not default constructed");
+				}
+
+				TEST_METHOD(Move)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<std::string>("string")
+					.Build();
+
+					ReflectedValue source(testLibrary.FindDescriptor<std::string>());
+					*source.Get<std::string>() = "A string long enough to not fit in the small string buffer";
+
+					/////////////
+					// Act
+					ReflectedValue destination = std::move(source);
+
+					/////////////
+					// Assert
+					Assert::IsFalse(source.HasValue(), L"Moved from value unexpectedly still holds a value");
+					Assert::AreEqual(std::string("A string long enough to not fit in the small string buffer"), *destination.Get<std::string>(), L"Moved value is unexpected");
+				}
+			};
+		}
+	}
+}
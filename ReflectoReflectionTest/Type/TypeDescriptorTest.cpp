@@ -51,16 +51,34 @@ namespace Reflecto
 						uint64_t Field4 = 0;
 					};
 
+					/////////////
+					// Act
 					const TypeLibrary typeLibrary = TypeLibraryFactory()
 						.Add<uint64_t>("uint64")
 						.Add<float>("float")
 						.Add<std::string>("string")
 						.Add<bool>("bool")
-						.Add<SampleClass>("SampleClass")
-						.Add<ChildSampleClass>("ChildSampleClass")
-						.Add<PrivateSampleClass>("PrivateSampleClass")
+						.Add(TypeDescriptorFactory<SampleClass>("SampleClass")
+							.RegisterMember(&SampleClass::Field1, "Field1")
+							.RegisterMember(&SampleClass::Field2, "Field2")
+							.RegisterMember(&SampleClass::Field3, "Field3")
+						.Build())
+						.Add(TypeDescriptorFactory<ChildSampleClass>("ChildSampleClass").RegisterParent<SampleClass>()
+							.RegisterMember(&ChildSampleClass::Field4, "Field4")
+						.Build())
+						.Add(TypeDescriptorFactory<PrivateSampleClass>("PrivateSampleClass")
+							.RegisterMember(GetPrivateMemberPointer(PrivateSampleClassFieldTag()), "Field")
+						.Build())
 					.Build();
 
+					const TypeDescriptorPtr uint64Descriptor = typeLibrary.GetDescriptor<uint64_t>();
+					const TypeDescriptorPtr sampleClassDescriptor = typeLibrary.GetDescriptor<SampleClass>();
+					const TypeDescriptorPtr childSampleClassDescriptor = typeLibrary.GetDescriptor<ChildSampleClass>();
+					const TypeDescriptorPtr privateSampleClassDescriptor = typeLibrary.GetDescriptor<PrivateSampleClass>();
+
+					////////////
+					// Assert
+					// Member types are linked to the descriptors of the library
 					const std::vector<MemberDescriptor> kExpectedMemberEmpty;
 					const std::vector<MemberDescriptor> kExpectedMembersSampleClass = [&] () -> std::vector<MemberDescriptor> {
 						MemberDescriptor m1(typeLibrary.GetDescriptor<float>(), "Field1", 0);
@@ -73,30 +91,13 @@ namespace Reflecto
 						return { m4 };
 					}();
 					const std::vector<MemberDescriptor> kExpectedMembersRecursiveChildSampleClass = [&]() -> std::vector<MemberDescriptor> {
-						return CollectionExt::Concatenate(kExpectedMembersChildSampleClass, kExpectedMembersRecursiveChildSampleClass);
+						return CollectionExt::Concatenate(kExpectedMembersSampleClass, kExpectedMembersChildSampleClass);
 					}();
 					const std::vector<MemberDescriptor> kExpectedPrivateMembers = [&] () -> std::vector<MemberDescriptor> {
 						MemberDescriptor m1(typeLibrary.GetDescriptor<float>(), "Field", 0);
 						return { m1 };
 					}();
 
-					/////////////
-					// Act
-					const TypeDescriptorUniquePtr uint64Descriptor = TypeDescriptorFactory<uint64_t>(typeLibrary, "uint64").Build();
-					const TypeDescriptorUniquePtr sampleClassDescriptor = TypeDescriptorFactory<SampleClass>(typeLibrary, "SampleClass")
-						.RegisterMember(&SampleClass::Field1, "Field1")
-						.RegisterMember(&SampleClass::Field2, "Field2")
-						.RegisterMember(&SampleClass::Field3, "Field3")
-					.Build();
-					const TypeDescriptorUniquePtr childSampleClassDescriptor = TypeDescriptorFactory<ChildSampleClass>(typeLibrary, "ChildSampleClass")
-						.RegisterMember(&ChildSampleClass::Field4, "Field4")
-					.Build();
-					const TypeDescriptorUniquePtr privateSampleClassDescriptor = TypeDescriptorFactory<PrivateSampleClass>(typeLibrary, "PrivateSampleClass")
-						.RegisterMember(GetPrivateMemberPointer(PrivateSampleClassFieldTag()), "Field")
-					.Build();
-
-					////////////
-					// Arrange
 					Assert::AreEqual(kExpectedMemberEmpty, uint64Descriptor->GetMembers(), L"Members are unexpected");
 					Assert::AreEqual(kExpectedMembersSampleClass, sampleClassDescriptor->GetMembers(), L"Members are unexpected");
 					Assert::AreEqual(kExpectedMembersChildSampleClass, childSampleClassDescriptor->GetMembers(), L"Members are unexpected");
@@ -110,13 +111,10 @@ namespace Reflecto
 					// Arrange
 					class SampleClass {};
 
-					const TypeLibrary typeLibrary = TypeLibraryFactory()
-						.Add<SampleClass>("SampleClass")
-					.Build();
 
 					/////////////
 					// Act
-					const TypeDescriptorUniquePtr descriptor = TypeDescriptorFactory<SampleClass>(typeLibrary, "SampleClass").Build();
+					const TypeDescriptorUniquePtr descriptor = TypeDescriptorFactory<SampleClass>("SampleClass").Build();
 
 					/////////////
 					// Assert
@@ -138,32 +136,32 @@ namespace Reflecto
 						void Method2Parameter(int32_t param1, int32_t param2) { }
 					};
 
+					/////////////
+					// Act
 					const TypeLibrary typeLibrary = TypeLibraryFactory()
-						.Add<SampleClass>("SampleClass")
+						.Add(TypeDescriptorFactory<SampleClass>("SampleClass")
+							.RegisterMethod(&SampleClass::MethodNoParameter, "MethodNoParameter")
+							.RegisterMethod(&SampleClass::MethodReturn, "MethodReturn")
+							.RegisterMethod(&SampleClass::Method1Parameter, "Method1Parameter", {"p"})
+							.RegisterMethod(&SampleClass::Method2Parameter, "Method2Parameter", {"param1", "param2"})
+						.Build())
 						.Add<int32_t>("int32")
 						.Add<bool>("bool")
 						.Add<std::string>("string")
 						.Add<void>("void")
 					.Build();
 
+					const TypeDescriptorPtr descriptor = typeLibrary.GetDescriptor<SampleClass>();
+
+					// Return and parameter types are linked to the descriptors of the library
 					const std::vector<MethodDescriptor> kExpectedMethod = [&] () -> std::vector<MethodDescriptor> {
-						MethodDescriptor m1(typeLibrary.GetDescriptor<void>(), "MethodNoParameter", {}, MethodDescriptor::weak_method_ptr_t<SampleClass>());
-						MethodDescriptor m2(typeLibrary.GetDescriptor<bool>(), "MethodReturn", {}, MethodDescriptor::weak_method_ptr_t<TestClass, bool>());
-						MethodDescriptor m3(typeLibrary.GetDescriptor<void>(), "Method1Parameter", {ParameterDescriptor(typeLibrary.GetDescriptor<std::string>(), "p")}, MethodDescriptor::weak_method_ptr_t<TestClass, int32_t>());
-						MethodDescriptor m4(typeLibrary.GetDescriptor<void>(), "Method2Parameter", { ParameterDescriptor(typeLibrary.GetDescriptor<int32_t>(), "param1"), ParameterDescriptor(typeLibrary.GetDescriptor<int32_t>(), "param2") }, MethodDescriptor::weak_method_ptr_t<SampleClass, int32_t, int32_t>());
+						MethodDescriptor m1(typeLibrary.GetDescriptor<void>(), "MethodNoParameter", {}, MethodDescriptor::weak_method_ptr_t<SampleClass, 0>());
+						MethodDescriptor m2(typeLibrary.GetDescriptor<bool>(), "MethodReturn", {}, MethodDescriptor::weak_method_ptr_t<SampleClass, 0>());
+						MethodDescriptor m3(typeLibrary.GetDescriptor<void>(), "Method1Parameter", {ParameterDescriptor(typeLibrary.GetDescriptor<std::string>(), "p")}, MethodDescriptor::weak_method_ptr_t<SampleClass, 1>());
+						MethodDescriptor m4(typeLibrary.GetDescriptor<void>(), "Method2Parameter", { ParameterDescriptor(typeLibrary.GetDescriptor<int32_t>(), "param1"), ParameterDescriptor(typeLibrary.GetDescriptor<int32_t>(), "param2") }, MethodDescriptor::weak_method_ptr_t<SampleClass, 2>());
 						return { m1, m2, m3, m4 };
 					}();
 
-					/////////////
-					// Act
-					const TypeDescriptorUniquePtr descriptor = TypeDescriptorFactory<SampleClass>(typeLibrary, "SampleClass")
-						.RegisterMethod(&SampleClass::MethodNoParameter, "MethodNoParameter")
-						.RegisterMethod(&SampleClass::MethodReturn, "MethodReturn")
-						.RegisterMethod(&SampleClass::Method1Parameter, "Method1Parameter", {"p"})
-						.RegisterMethod(&SampleClass::Method2Parameter, "Method2Parameter", {"param1", "param2"})
-					.Build();
-
-
 					/////////////
 					// Assert
 					Assert::AreEqual(kExpectedMethod, descriptor->GetMethods());
@@ -1,16 +1,66 @@
 #include "TestCommon.h"
 
 #include "Type/TypeDescriptor.h"
+#include "Type/TypeDescriptorFactory.h"
 #include "Type/TypeLibrary.h"
 #include "Type/TypeLibraryFactory.h"
+#include "Utils/StringExt.h"
 
 #include <CppUnitTest.h>
+#include <cstddef>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+namespace
+{
+	struct ExplicitlyIdentified { };
+
+	struct CollidingIdentified { };
+
+	struct LayoutBase
+	{
+		int32_t Id;
+	};
+
+	struct LayoutDerived : public LayoutBase
+	{
+		float Weight;
+		std::string Label;
+	};
+
+	struct LayoutOther
+	{
+		double Value;
+	};
+
+	struct LayoutMultiple : public LayoutOther, public LayoutBase
+	{
+		int32_t Extra;
+	};
+
+	struct LayoutVirtual : public virtual LayoutBase
+	{
+		int32_t Extra;
+	};
+
+	struct LayoutLarge
+	{
+		LayoutLarge(int32_t value)
+			: Last(value)
+		{ }
+
+		char Buffer[4096];
+		int32_t Last;
+	};
+}
+
+REFLECTO_TYPE_ID(ExplicitlyIdentified, "ExplicitlyIdentified")
+REFLECTO_TYPE_ID(CollidingIdentified, "ExplicitlyIdentified")
+
 namespace Reflecto
 {
 	namespace Reflection
@@ -89,6 +139,369 @@ namespace Reflecto
 					Assert::IsTrue(actualStringType != nullptr, L"Type is unexpectedly missing");
 					Assert::IsTrue(actualMissingType == nullptr, L"Missing type is unexpectedly available");
 				}
+
+				TEST_METHOD(Find)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<uint32_t>("uint32")
+						.Add<std::string>("string")
+						.Build();
+
+					/////////////
+					// Act
+					const TypeDescriptor* actualUIntType = testLibrary.FindDescriptor<uint32_t>();
+					const TypeDescriptor* actualStringType = testLibrary.FindDescriptorByName("string");
+					const TypeDescriptor* actualMissingType = testLibrary.FindDescriptorByHash(TypeExt::GetTypeHash<bool>());
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualUIntType == testLibrary.GetDescriptor<uint32_t>().get(), L"Borrowed type is expected to be the owned type");
+					Assert::IsTrue(actualStringType == testLibrary.GetDescriptor<std::string>().get(), L"Borrowed type is expected to be the owned type");
+					Assert::IsTrue(actualMissingType == nullptr, L"Missing type is unexpectedly available");
+				}
+
+				TEST_METHOD(GetLayout)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.Add<float>("float")
+						.Add<std::string>("string")
+						.BeginType<LayoutBase>("LayoutBase")
+							.RegisterMember(&LayoutBase::Id, "Id")
+						.EndType<LayoutBase>()
+						.BeginType<LayoutDerived, LayoutBase>("LayoutDerived")
+							.RegisterMember(&LayoutDerived::Weight, "Weight")
+							.RegisterMember(&LayoutDerived::Label, "Label")
+						.EndType<LayoutDerived>()
+					.Build();
+
+					/////////////
+					// Act
+					const TypeLibraryLayout& layout = testLibrary.GetLayout();
+					const uint32_t derivedIndex = testLibrary.GetTypeIndex<LayoutDerived>();
+					const TypeLayout& actualDerived = layout.GetType(derivedIndex);
+					const TypeLayout& actualString = layout.GetType(testLibrary.GetTypeIndex<std::string>());
+					const MemberLayoutRange actualMembers = layout.GetMembers(derivedIndex);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualDerived.kind == TypeKind::Object, L"Type with members is expected to be an object");
+					Assert::IsTrue(actualString.kind == TypeKind::Value, L"Type without members is expected to be a value");
+					Assert::AreEqual(testLibrary.GetTypeIndex<LayoutBase>(), actualDerived.parentIndex, L"Parent index is unexpected");
+					Assert::AreEqual(static_cast<size_t>(2), actualMembers.size(), L"Member count is unexpected");
+					Assert::AreEqual(static_cast<uint32_t>(offsetof(LayoutDerived, Weight)), actualMembers.begin()[0].offset, L"Member offset is unexpected");
+					Assert::AreEqual(testLibrary.GetTypeIndex<float>(), actualMembers.begin()[0].typeIndex, L"Member type is unexpected");
+					Assert::AreEqual(static_cast<uint32_t>(offsetof(LayoutDerived, Label)), actualMembers.begin()[1].offset, L"Member offset is unexpected");
+					Assert::AreEqual(testLibrary.GetTypeIndex<std::string>(), actualMembers.begin()[1].typeIndex, L"Member type is unexpected");
+					Assert::AreEqual(std::string("Label"), layout.GetMemberDescriptor(actualMembers.begin()[1]).GetName(), L"Member name is unexpected");
+				}
+
+				TEST_METHOD(GetStorage)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<double>("double")
+						.Add<std::string>("string")
+						.Add<LayoutDerived>("LayoutDerived")
+						.Add<LayoutMultiple>("LayoutMultiple")
+					.Build();
+
+					/////////////
+					// Act
+					const TypeStorage& actualDoubleStorage = testLibrary.FindDescriptor<double>()->GetStorage();
+					const TypeStorage& actualStringStorage = testLibrary.FindDescriptor<std::string>()->GetStorage();
+					const TypeStorage& actualDerivedStorage = testLibrary.FindDescriptor<LayoutDerived>()->GetStorage();
+					const TypeStorage& actualMultipleStorage = testLibrary.FindDescriptor<LayoutMultiple>()->GetStorage();
+
+					/////////////
+					// Assert
+					Assert::AreEqual(sizeof(double), actualDoubleStorage.size, L"Unexpected size");
+					Assert::AreEqual(alignof(double), actualDoubleStorage.alignment, L"Unexpected alignment");
+					Assert::IsTrue(actualDoubleStorage.triviallyCopyable, L"Number unexpectedly not trivially copyable");
+					Assert::IsFalse(actualStringStorage.triviallyCopyable, L"String unexpectedly trivially copyable");
+					Assert::AreEqual(sizeof(LayoutDerived), actualDerivedStorage.size, L"Unexpected size");
+					Assert::IsFalse(actualDerivedStorage.triviallyCopyable, L"Type with a string member unexpectedly trivially copyable");
+					Assert::AreEqual(sizeof(LayoutMultiple), actualMultipleStorage.size, L"Unexpected size");
+					Assert::AreEqual(alignof(LayoutMultiple), actualMultipleStorage.alignment, L"Unexpected alignment");
+					Assert::IsTrue(actualMultipleStorage.triviallyCopyable, L"Plain type unexpectedly not trivially copyable");
+				}
+
+				TEST_METHOD(GetForwardReference)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.BeginType<LayoutDerived, LayoutBase>("LayoutDerived")
+							.RegisterMember(&LayoutDerived::Weight, "Weight")
+							.RegisterMember(&LayoutDerived::Label, "Label")
+						.EndType<LayoutDerived>()
+						.BeginType<LayoutBase>("LayoutBase")
+							.RegisterMember(&LayoutBase::Id, "Id")
+						.EndType<LayoutBase>()
+						.Add<int32_t>("int32")
+						.Add<float>("float")
+						.Add<std::string>("string")
+					.Build();
+
+					/////////////
+					// Act
+					const TypeDescriptor* actualDerived = testLibrary.FindDescriptor<LayoutDerived>();
+					const MemberDescriptor* actualInheritedMember = actualDerived ? actualDerived->GetMemberByNameRecursive("Id") : nullptr;
+					const MemberDescriptor* actualMember = actualDerived ? actualDerived->GetMemberByName("Label") : nullptr;
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualDerived && actualDerived->GetParent() == testLibrary.FindDescriptor<LayoutBase>(), L"Parent registered later is expected to be linked");
+					Assert::IsTrue(actualInheritedMember && actualInheritedMember->GetType() == testLibrary.FindDescriptor<int32_t>(), L"Inherited member is expected to be linked");
+					Assert::IsTrue(actualMember && actualMember->GetType() == testLibrary.FindDescriptor<std::string>(), L"Member type registered later is expected to be linked");
+				}
+
+				TEST_METHOD(GetSharedDescriptor)
+				{
+					/////////////
+					// Arrange
+					const TypeDescriptorPtr sharedDerived = TypeDescriptorFactory<LayoutDerived>("LayoutDerived").RegisterParent<LayoutBase>()
+						.RegisterMember(&LayoutDerived::Weight, "Weight")
+					.Build();
+
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<LayoutBase>("LayoutBase")
+						.Add<float>("float")
+						.Add(sharedDerived)
+					.Build();
+
+					/////////////
+					// Act
+					{
+						// Library sharing the descriptor and destroyed first
+						const TypeLibrary otherLibrary = TypeLibraryFactory()
+							.Add<LayoutBase>("LayoutBase")
+							.Add<float>("float")
+							.Add(sharedDerived)
+						.Build();
+					}
+					const TypeDescriptor* actualDerived = testLibrary.FindDescriptor<LayoutDerived>();
+					const MemberDescriptor* actualMember = actualDerived ? actualDerived->GetMemberByName("Weight") : nullptr;
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualDerived && actualDerived != sharedDerived.get(), L"Library is expected to link its own copy of the descriptor");
+					Assert::IsTrue(actualDerived->GetParent() == testLibrary.FindDescriptor<LayoutBase>(), L"Parent is expected to be linked within the library");
+					Assert::IsTrue(actualMember && actualMember->GetType() == testLibrary.FindDescriptor<float>(), L"Member type is expected to be linked within the library");
+					Assert::IsTrue(sharedDerived->GetParent() == nullptr, L"Added descriptor is expected to be left unlinked");
+				}
+
+				TEST_METHOD(GetInheritedMembers)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.BeginType<LayoutMultiple, LayoutBase>("LayoutMultiple")
+							.RegisterMember(&LayoutMultiple::Extra, "Extra")
+						.EndType<LayoutMultiple>()
+						.BeginType<LayoutBase>("LayoutBase")
+							.RegisterMember(&LayoutBase::Id, "Id")
+						.EndType<LayoutBase>()
+					.Build();
+
+					LayoutMultiple instance;
+					const uint32_t expectedIdOffset = static_cast<uint32_t>(reinterpret_cast<const char*>(&instance.Id) - reinterpret_cast<const char*>(&instance));
+
+					/////////////
+					// Act
+					const TypeDescriptor* actualType = testLibrary.FindDescriptor<LayoutMultiple>();
+					const MemberDescriptor* actualInherited = actualType ? actualType->GetMemberByNameRecursive("Id") : nullptr;
+					const MemberDescriptor* actualOwn = actualType ? actualType->GetMemberByNameRecursive("Extra") : nullptr;
+					const MemberDescriptor* actualMissing = actualType ? actualType->GetMemberByNameRecursive("Ie") : nullptr;
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualInherited != nullptr, L"Inherited member is unexpectedly missing");
+					Assert::IsTrue(actualOwn != nullptr, L"Member is unexpectedly missing");
+					Assert::IsTrue(actualMissing == nullptr, L"Missing member is unexpectedly available");
+					Assert::AreEqual(expectedIdOffset, actualInherited->GetOffset(), L"Inherited member offset is expected relative to the derived type");
+					Assert::IsTrue(actualInherited->ResolveMember(instance) == &instance.Id, L"Inherited member is expected relative to the derived type");
+					Assert::AreEqual(static_cast<size_t>(2), actualType->FetchMemberResursive().size(), L"Flattened member count is unexpected");
+				}
+
+				TEST_METHOD(GetVirtualInheritedMembers)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.BeginType<LayoutVirtual, LayoutBase>("LayoutVirtual")
+							.RegisterMember(&LayoutVirtual::Extra, "Extra")
+						.EndType<LayoutVirtual>()
+						.BeginType<LayoutBase>("LayoutBase")
+							.RegisterMember(&LayoutBase::Id, "Id")
+						.EndType<LayoutBase>()
+					.Build();
+
+					LayoutVirtual instance;
+
+					/////////////
+					// Act
+					const TypeDescriptor* actualType = testLibrary.FindDescriptor<LayoutVirtual>();
+					const MemberDescriptor* actualInherited = actualType ? actualType->GetMemberByNameRecursive("Id") : nullptr;
+					const MemberDescriptor* actualOwn = actualType ? actualType->GetMemberByNameRecursive("Extra") : nullptr;
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualInherited != nullptr && actualOwn != nullptr, L"Member is unexpectedly missing");
+					Assert::IsFalse(actualInherited->HasOffset(), L"Member of a virtual base unexpectedly has an offset");
+					Assert::IsTrue(actualInherited->ResolveMember(instance) == &instance.Id, L"Member of a virtual base is unexpectedly resolved");
+					Assert::IsTrue(actualOwn->ResolveMember(instance) == &instance.Extra, L"Member is unexpectedly resolved");
+				}
+
+				TEST_METHOD(GetLargeType)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.BeginType<LayoutLarge>("LayoutLarge")
+							.RegisterMember(&LayoutLarge::Last, "Last")
+						.EndType<LayoutLarge>()
+					.Build();
+
+					LayoutLarge instance(5);
+
+					/////////////
+					// Act
+					const TypeDescriptor* actualType = testLibrary.FindDescriptor<LayoutLarge>();
+					const MemberDescriptor* actualMember = actualType ? actualType->GetMemberByName("Last") : nullptr;
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualMember != nullptr, L"Member is unexpectedly missing");
+					Assert::IsFalse(actualMember->HasOffset(), L"Member of a type that cannot be sampled unexpectedly has an offset");
+					Assert::IsTrue(actualMember->ResolveMember(instance) == &instance.Last, L"Member past 255 bytes is unexpectedly resolved");
+					Assert::IsFalse(actualType->GetConstructor().has_value(), L"Type without default constructor is unexpectedly constructible");
+				}
+
+				TEST_METHOD(GetManyTypes)
+				{
+					/////////////
+					// Arrange
+					const uint32_t kTypeCount = 1000;
+					std::vector<TypeDescriptorPtr> types;
+					for (uint32_t i = 0; i < kTypeCount; ++i)
+					{
+						const std::string name = StringExt::Format<std::string>("Type%u", i);
+						types.push_back(std::make_shared<TypeDescriptor>(name, TypeExt::GetTypeInfo<void>(), static_cast<typehash_t>(i) * 4096));
+					}
+					TypeLibrary testLibrary(types);
+
+					/////////////
+					// Act
+					bool allFoundByHash = true;
+					bool allFoundByName = true;
+					for (uint32_t i = 0; i < kTypeCount; ++i)
+					{
+						allFoundByHash &= testLibrary.GetDescriptorByHash(static_cast<typehash_t>(i) * 4096) == types[i];
+						allFoundByName &= testLibrary.GetDescriptorByName(StringExt::Format<std::string>("Type%u", i)) == types[i];
+					}
+					const TypeDescriptorPtr actualMissingByHash = testLibrary.GetDescriptorByHash(1);
+					const TypeDescriptorPtr actualMissingByName = testLibrary.GetDescriptorByName("Type");
+
+					/////////////
+					// Assert
+					Assert::IsTrue(allFoundByHash, L"Type is unexpectedly missing");
+					Assert::IsTrue(allFoundByName, L"Type is unexpectedly missing");
+					Assert::IsTrue(actualMissingByHash == nullptr, L"Missing type is unexpectedly available");
+					Assert::IsTrue(actualMissingByName == nullptr, L"Missing type is unexpectedly available");
+				}
+
+				TEST_METHOD(GetByQualifiedType)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.Add<ExplicitlyIdentified>("ExplicitlyIdentified")
+					.Build();
+
+					/////////////
+					// Act
+					const TypeDescriptorPtr actualConstType = testLibrary.GetDescriptor<const int32_t>();
+					const TypeDescriptorPtr actualReferenceType = testLibrary.GetDescriptor<const int32_t&>();
+					const TypeDescriptorPtr actualExplicitType = testLibrary.GetDescriptorByHash(TypeExt::HashTypeName("ExplicitlyIdentified"));
+
+					/////////////
+					// Assert
+					static_assert(TypeExt::GetTypeHash<int32_t>() != TypeExt::GetTypeHash<uint32_t>(), "Type hashes are expected to be distinct");
+					Assert::IsTrue(actualConstType && actualConstType->Is<int32_t>(), L"Qualified type is expected to resolve to its unqualified type");
+					Assert::IsTrue(actualReferenceType && actualReferenceType->Is<int32_t>(), L"Reference type is expected to resolve to its referred type");
+					Assert::IsTrue(actualExplicitType && actualExplicitType->Is<ExplicitlyIdentified>(), L"Explicitly identified type is expected to be found by its name hash");
+				}
+
+				TEST_METHOD(GetCollidingType)
+				{
+					/////////////
+					// Arrange
+					TypeLibraryFactory testFactory = TypeLibraryFactory()
+						.Add<ExplicitlyIdentified>("ExplicitlyIdentified")
+						.Add<CollidingIdentified>("CollidingIdentified");
+
+					/////////////
+					// Act
+					bool success = true;
+					const TypeLibrary testLibrary = testFactory.Build(success);
+					const TypeDescriptorPtr actualType = testLibrary.GetDescriptor<CollidingIdentified>();
+
+					/////////////
+					// Assert
+					Assert::IsFalse(success, L"Types sharing an identifier are unexpectedly built");
+					Assert::IsTrue(actualType && actualType->Is<ExplicitlyIdentified>() && actualType->GetName() == "ExplicitlyIdentified", L"First type is expected to be kept");
+				}
+
+				TEST_METHOD(GetArrayType)
+				{
+					/////////////
+					// Arrange
+					TypeLibrary testLibrary = TypeLibraryFactory()
+						.Add<int32_t[2]>("int32[2]")
+						.Add<int32_t[2][3]>("int32[2][3]")
+					.Build();
+
+					/////////////
+					// Act
+					const std::string_view actualSignature = TypeExt::GetTypeSignature<int32_t[2][3]>();
+					const TypeDescriptorPtr actualArrayType = testLibrary.GetDescriptor<int32_t[2]>();
+					const TypeDescriptorPtr actualNestedArrayType = testLibrary.GetDescriptor<int32_t[2][3]>();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualSignature.size() > 3 && actualSignature.substr(actualSignature.size() - 3) == "[3]", L"Array type signature is unexpectedly cut");
+					Assert::IsTrue(actualArrayType && actualArrayType->GetName() == "int32[2]", L"Array type is unexpectedly missing");
+					Assert::IsTrue(actualNestedArrayType && actualNestedArrayType->GetName() == "int32[2][3]", L"Nested array type is unexpectedly missing");
+				}
+
+				TEST_METHOD(GetDuplicate)
+				{
+					/////////////
+					// Arrange
+					const TypeDescriptorPtr first = std::make_shared<TypeDescriptor>("duplicate", TypeExt::GetTypeInfo<int32_t>(), 42);
+					const TypeDescriptorPtr second = std::make_shared<TypeDescriptor>("duplicate", TypeExt::GetTypeInfo<float>(), 42);
+					TypeLibrary testLibrary({ first, second });
+
+					/////////////
+					// Act
+					const TypeDescriptorPtr actualByHash = testLibrary.GetDescriptorByHash(42);
+					const TypeDescriptorPtr actualByName = testLibrary.GetDescriptorByName("duplicate");
+
+					/////////////
+					// Assert
+					Assert::IsTrue(actualByHash == first, L"First registered type is expected");
+					Assert::IsTrue(actualByName == first, L"First registered type is expected");
+				}
 			};
 		}
 	}
@@ -0,0 +1,265 @@
+#pragma once
+
+#include "Utils/CpuExt.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Standard base64 with padding, used by text formats for raw bytes. Encoding and decoding
+		// go 24 bytes to 32 characters at a time with AVX2 when the processor has it and through
+		// tables otherwise, both giving the same output. Decoding is strict: the text must be
+		// padded to a multiple of 4 characters and hold nothing but the alphabet.
+		class Base64Encoding
+		{
+		public:
+			enum class Implementation : uint8_t
+			{
+				Scalar,
+				Avx2
+			};
+
+			static bool IsSupported(Implementation implementation)
+			{
+				bool supported = implementation == Implementation::Scalar;
+#ifdef REFLECTO_X64
+				supported |= implementation == Implementation::Avx2 && CpuExt::HasAvx2();
+#endif
+				return supported;
+			}
+
+			static Implementation GetBestImplementation()
+			{
+				static const Implementation best = IsSupported(Implementation::Avx2) ? Implementation::Avx2 : Implementation::Scalar;
+				return best;
+			}
+
+			static size_t GetEncodedSize(size_t size)
+			{
+				return (size + 2) / 3 * 4;
+			}
+
+			// Appends the encoded bytes to the text
+			static void Encode(std::string_view bytes, std::string& text)
+			{
+				Encode(bytes, text, GetBestImplementation());
+			}
+
+			static void Encode(std::string_view bytes, std::string& text, Implementation implementation)
+			{
+				const size_t start = text.size();
+				text.resize(start + GetEncodedSize(bytes.size()));
+				const uint8_t* input = reinterpret_cast<const uint8_t*>(bytes.data());
+				char* output = &text[start];
+
+				size_t position = 0;
+#ifdef REFLECTO_X64
+				if (implementation == Implementation::Avx2 && IsSupported(implementation))
+				{
+					position = EncodeAvx2(input, bytes.size(), output);
+				}
+#endif
+				EncodeScalar(input + position, bytes.size() - position, output + position / 3 * 4);
+			}
+
+			// Replaces the bytes with the decoded text, fails on malformed text
+			static bool Decode(std::string_view text, std::string& bytes)
+			{
+				return Decode(text, bytes, GetBestImplementation());
+			}
+
+			static bool Decode(std::string_view text, std::string& bytes, Implementation implementation)
+			{
+				bool success = text.size() % 4 == 0;
+				if (success)
+				{
+					size_t padding = 0;
+					if (!text.empty() && text[text.size() - 1] == '=')
+					{
+						padding = text[text.size() - 2] == '=' ? 2 : 1;
+					}
+					bytes.resize(text.size() / 4 * 3 - padding);
+
+					const char* input = text.data();
+					uint8_t* output = reinterpret_cast<uint8_t*>(bytes.data());
+					size_t position = 0;
+#ifdef REFLECTO_X64
+					if (implementation == Implementation::Avx2 && IsSupported(implementation))
+					{
+						success &= DecodeAvx2(input, text.size(), output, position);
+					}
+#endif
+					success = success && DecodeScalar(input + position, text.size() - position, output + position / 4 * 3);
+				}
+				if (!success)
+				{
+					bytes.clear();
+				}
+				return success;
+			}
+
+		private:
+			static constexpr char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+			static constexpr uint8_t kInvalid = 0xFF;
+
+			// Value of every character, kInvalid outside the alphabet
+			static const uint8_t* GetDecodeTable()
+			{
+				static const std::array<uint8_t, 256> table = [] {
+					std::array<uint8_t, 256> values;
+					values.fill(kInvalid);
+					for (uint8_t i = 0; i < 64; ++i)
+					{
+						values[static_cast<uint8_t>(kAlphabet[i])] = i;
+					}
+					return values;
+				}();
+				return table.data();
+			}
+
+			static void EncodeScalar(const uint8_t* input, size_t size, char* output)
+			{
+				size_t i = 0;
+				for (; i + 3 <= size; i += 3)
+				{
+					const uint32_t group = (uint32_t(input[i]) << 16) | (uint32_t(input[i + 1]) << 8) | input[i + 2];
+					*output++ = kAlphabet[(group >> 18) & 0x3F];
+					*output++ = kAlphabet[(group >> 12) & 0x3F];
+					*output++ = kAlphabet[(group >> 6) & 0x3F];
+					*output++ = kAlphabet[group & 0x3F];
+				}
+
+				if (i < size)
+				{
+					const bool two = size - i == 2;
+					const uint32_t group = (uint32_t(input[i]) << 16) | (two ? uint32_t(input[i + 1]) << 8 : 0);
+					*output++ = kAlphabet[(group >> 18) & 0x3F];
+					*output++ = kAlphabet[(group >> 12) & 0x3F];
+					*output++ = two ? kAlphabet[(group >> 6) & 0x3F] : '=';
+					*output++ = '=';
+				}
+			}
+
+			// Padding is only allowed at the end of the last group
+			static bool DecodeScalar(const char* input, size_t size, uint8_t* output)
+			{
+				const uint8_t* table = GetDecodeTable();
+				bool success = true;
+				for (size_t i = 0; i < size && success; i += 4)
+				{
+					const bool last = i + 4 == size;
+					const size_t padding = last && input[i + 3] == '=' ? (input[i + 2] == '=' ? 2 : 1) : 0;
+
+					uint32_t group = 0;
+					uint8_t invalid = 0;
+					for (size_t j = 0; j < 4 - padding; ++j)
+					{
+						const uint8_t value = table[static_cast<uint8_t>(input[i + j])];
+						invalid |= value;
+						group |= uint32_t(value) << (18 - 6 * j);
+					}
+					success = (invalid & 0xC0) == 0;
+
+					*output++ = static_cast<uint8_t>(group >> 16);
+					if (padding < 2)
+					{
+						*output++ = static_cast<uint8_t>(group >> 8);
+					}
+					if (padding < 1)
+					{
+						*output++ = static_cast<uint8_t>(group);
+					}
+				}
+				return success;
+			}
+
+#ifdef REFLECTO_X64
+			// Each 128 bit lane turns 12 bytes into 16 characters: bytes are spread to 6 bit
+			// indices with multiplications, then indices are turned into characters by adding an
+			// offset looked up from the range they fall in. Returns how many bytes were encoded,
+			// the scalar encoder finishes the rest.
+			REFLECTO_TARGET_AVX2 static size_t EncodeAvx2(const uint8_t* input, size_t size, char* output)
+			{
+				const __m256i spread = _mm256_setr_epi8(
+					1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+					1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+				const __m256i offsets = _mm256_setr_epi8(
+					'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+					'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+					'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+					'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+				// Lanes load 16 bytes of which 12 are used
+				size_t i = 0;
+				for (; i + 28 <= size; i += 24)
+				{
+					const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+					const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 12));
+					const __m256i bytes = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), spread);
+
+					const __m256i first = _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+					const __m256i second = _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+					const __m256i indices = _mm256_or_si256(first, second);
+
+					// 0 for lowercase letters, 1 to 10 for digits, 11 for '+', 12 for '/' and 13 for uppercase letters
+					__m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+					range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+					const __m256i characters = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i / 3 * 4), characters);
+				}
+				return i;
+			}
+
+			// Characters are validated and turned into 6 bit values through nibble lookups, then
+			// values are packed with multiply-adds and each lane stores 12 bytes. The last groups,
+			// which may hold padding, are left to the scalar decoder, as are the 4 bytes lanes
+			// write past their 12.
+			REFLECTO_TARGET_AVX2 static bool DecodeAvx2(const char* input, size_t size, uint8_t* output, size_t& position)
+			{
+				const __m256i lowLookup = _mm256_setr_epi8(
+					0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+					0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+				const __m256i highLookup = _mm256_setr_epi8(
+					0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+					0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+				const __m256i offsets = _mm256_setr_epi8(
+					0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+				const __m256i pack = _mm256_setr_epi8(
+					2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+					2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+				bool success = true;
+				size_t i = 0;
+				for (; i + 40 <= size && success; i += 32)
+				{
+					const __m256i characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+					const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(characters, 4), _mm256_set1_epi8(0x0F));
+					const __m256i lowNibbles = _mm256_and_si256(characters, _mm256_set1_epi8(0x0F));
+					success = _mm256_testz_si256(_mm256_shuffle_epi8(lowLookup, lowNibbles), _mm256_shuffle_epi8(highLookup, highNibbles)) != 0;
+					if (success)
+					{
+						const __m256i slash = _mm256_cmpeq_epi8(characters, _mm256_set1_epi8('/'));
+						const __m256i values = _mm256_add_epi8(characters, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(slash, highNibbles)));
+
+						const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+						const __m256i groups = _mm256_shuffle_epi8(_mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000)), pack);
+
+						uint8_t* destination = output + i / 4 * 3;
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm256_castsi256_si128(groups));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 12), _mm256_extracti128_si256(groups, 1));
+					}
+				}
+				position = i;
+				return success;
+			}
+#endif
+		};
+	}
+}
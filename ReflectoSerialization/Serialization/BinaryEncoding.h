@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// How object properties are identified in the binary format
+		enum class BinaryPropertyFormat : uint8_t
+		{
+			// Every property is written as its length prefixed name
+			Name,
+			// Every property is written as the varint index of its name, the name itself is written
+			// only the first time it appears in the buffer
+			Index
+		};
+
+		// Primitives shared by the binary writer and reader: fixed size little endian values and
+		// LEB128 varints. Fixed values are assembled byte by byte so the format does not depend on
+		// the endianness of the machine.
+		namespace BinaryEncoding
+		{
+			constexpr size_t kMaxVarintSize = 10;
+
+			// Presence of an optional, written before its value when it has one
+			constexpr char kNullTag = '\x00';
+			constexpr char kPresentTag = '\x01';
+
+			template<typename value_t>
+			void AppendFixed(std::string& buffer, value_t value)
+			{
+				using bits_t = std::conditional_t<sizeof(value_t) == 8, uint64_t, std::conditional_t<sizeof(value_t) == 4, uint32_t, uint8_t>>;
+				static_assert(sizeof(bits_t) == sizeof(value_t), "Unsupported fixed size value");
+
+				bits_t bits;
+				std::memcpy(&bits, &value, sizeof(value_t));
+				char bytes[sizeof(value_t)];
+				for (size_t i = 0; i < sizeof(value_t); ++i)
+				{
+					bytes[i] = static_cast<char>(bits >> (8 * i));
+				}
+				buffer.append(bytes, sizeof(value_t));
+			}
+
+			template<typename value_t>
+			bool ReadFixed(std::string_view input, size_t& position, value_t& value)
+			{
+				using bits_t = std::conditional_t<sizeof(value_t) == 8, uint64_t, std::conditional_t<sizeof(value_t) == 4, uint32_t, uint8_t>>;
+				static_assert(sizeof(bits_t) == sizeof(value_t), "Unsupported fixed size value");
+
+				bool success = false;
+				if (input.size() - position >= sizeof(value_t))
+				{
+					bits_t bits = 0;
+					for (size_t i = 0; i < sizeof(value_t); ++i)
+					{
+						bits |= static_cast<bits_t>(static_cast<uint8_t>(input[position + i])) << (8 * i);
+					}
+					std::memcpy(&value, &bits, sizeof(value_t));
+					position += sizeof(value_t);
+					success = true;
+				}
+				return success;
+			}
+
+			inline bool IsLittleEndian()
+			{
+				const uint16_t probe = 1;
+				uint8_t first = 0;
+				std::memcpy(&first, &probe, sizeof(first));
+				return first == 1;
+			}
+
+			// Contiguous fixed size values, copied at once when the machine is little endian
+			template<typename value_t>
+			void AppendFixedArray(std::string& buffer, const value_t* values, size_t count)
+			{
+				if (IsLittleEndian())
+				{
+					buffer.append(reinterpret_cast<const char*>(values), count * sizeof(value_t));
+				}
+				else
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						AppendFixed(buffer, values[i]);
+					}
+				}
+			}
+
+			template<typename value_t>
+			bool ReadFixedArray(std::string_view input, size_t& position, value_t* values, size_t count)
+			{
+				bool success = false;
+				if ((input.size() - position) / sizeof(value_t) >= count)
+				{
+					if (IsLittleEndian())
+					{
+						std::memcpy(values, input.data() + position, count * sizeof(value_t));
+						position += count * sizeof(value_t);
+					}
+					else
+					{
+						for (size_t i = 0; i < count; ++i)
+						{
+							ReadFixed(input, position, values[i]);
+						}
+					}
+					success = true;
+				}
+				return success;
+			}
+
+			// Writes into bytes, which must hold kMaxVarintSize, and returns the size written
+			inline size_t EncodeVarint(uint64_t value, char* bytes)
+			{
+				size_t size = 0;
+				while (value >= 0x80)
+				{
+					bytes[size++] = static_cast<char>((value & 0x7F) | 0x80);
+					value >>= 7;
+				}
+				bytes[size++] = static_cast<char>(value);
+				return size;
+			}
+
+			inline void AppendVarint(std::string& buffer, uint64_t value)
+			{
+				char bytes[kMaxVarintSize];
+				buffer.append(bytes, EncodeVarint(value, bytes));
+			}
+
+			inline bool ReadVarint(std::string_view input, size_t& position, uint64_t& value)
+			{
+				bool success = false;
+				value = 0;
+				for (uint32_t shift = 0; shift < 64 && position < input.size(); shift += 7)
+				{
+					const uint8_t byte = static_cast<uint8_t>(input[position++]);
+					value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+					if ((byte & 0x80) == 0)
+					{
+						success = true;
+						break;
+					}
+				}
+				return success;
+			}
+
+			inline void AppendString(std::string& buffer, std::string_view value)
+			{
+				AppendVarint(buffer, value.size());
+				buffer.append(value.data(), value.size());
+			}
+
+			// Reads a view into the input, valid for as long as the input is
+			inline bool ReadString(std::string_view input, size_t& position, std::string_view& value)
+			{
+				bool success = false;
+				uint64_t size = 0;
+				if (ReadVarint(input, position, size) && size <= input.size() - position)
+				{
+					value = input.substr(position, static_cast<size_t>(size));
+					position += static_cast<size_t>(size);
+					success = true;
+				}
+				return success;
+			}
+		}
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Raw bytes serialized as a whole rather than as an array of numbers: binary formats
+		// write them as they are and text formats as base64.
+		class Blob
+		{
+		public:
+			Blob() = default;
+
+			explicit Blob(std::string bytes)
+				: _bytes(std::move(bytes))
+			{ }
+
+			Blob(const uint8_t* data, size_t size)
+				: _bytes(reinterpret_cast<const char*>(data), size)
+			{ }
+
+			const uint8_t* GetData() const
+			{
+				return reinterpret_cast<const uint8_t*>(_bytes.data());
+			}
+
+			size_t GetSize() const
+			{
+				return _bytes.size();
+			}
+
+			std::string_view GetBytes() const
+			{
+				return _bytes;
+			}
+
+			// Storage of the bytes, also used to read them in place
+			std::string& GetStorage()
+			{
+				return _bytes;
+			}
+
+			bool operator==(const Blob& other) const
+			{
+				return _bytes == other._bytes;
+			}
+
+			bool operator!=(const Blob& other) const
+			{
+				return !(*this == other);
+			}
+
+		private:
+			std::string _bytes;
+		};
+	}
+}
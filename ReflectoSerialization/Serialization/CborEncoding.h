@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Data item heads of RFC 8949 and the float conversions of its preferred serialization,
+		// shared by the CBOR writer and reader
+		namespace CborEncoding
+		{
+			enum class MajorType : uint8_t
+			{
+				UnsignedInteger = 0,
+				NegativeInteger = 1,
+				ByteString = 2,
+				TextString = 3,
+				Array = 4,
+				Map = 5,
+				Tag = 6,
+				Simple = 7
+			};
+
+			constexpr uint8_t kFalse = 0xF4;
+			constexpr uint8_t kTrue = 0xF5;
+			constexpr uint8_t kNull = 0xF6;
+			constexpr uint8_t kFloat16 = 0xF9;
+			constexpr uint8_t kFloat32 = 0xFA;
+			constexpr uint8_t kFloat64 = 0xFB;
+
+			constexpr uint8_t kArgumentInline = 23;
+			constexpr uint8_t kArgument8 = 24;
+			constexpr uint8_t kArgument16 = 25;
+			constexpr uint8_t kArgument32 = 26;
+			constexpr uint8_t kArgument64 = 27;
+			constexpr uint8_t kIndefinite = 31;
+			constexpr size_t kMaxHeadSize = 9;
+
+			// Head with the shortest argument, as deterministic encoding requires. Writes into bytes,
+			// which must hold kMaxHeadSize, and returns the size written.
+			inline size_t EncodeHead(MajorType major, uint64_t argument, char* bytes)
+			{
+				const uint8_t type = static_cast<uint8_t>(major) << 5;
+				size_t argumentSize = 0;
+				if (argument <= kArgumentInline)
+				{
+					bytes[0] = static_cast<char>(type | argument);
+				}
+				else if (argument <= UINT8_MAX)
+				{
+					bytes[0] = static_cast<char>(type | kArgument8);
+					argumentSize = 1;
+				}
+				else if (argument <= UINT16_MAX)
+				{
+					bytes[0] = static_cast<char>(type | kArgument16);
+					argumentSize = 2;
+				}
+				else if (argument <= UINT32_MAX)
+				{
+					bytes[0] = static_cast<char>(type | kArgument32);
+					argumentSize = 4;
+				}
+				else
+				{
+					bytes[0] = static_cast<char>(type | kArgument64);
+					argumentSize = 8;
+				}
+
+				for (size_t i = 0; i < argumentSize; ++i)
+				{
+					bytes[1 + i] = static_cast<char>(argument >> (8 * (argumentSize - 1 - i)));
+				}
+				return 1 + argumentSize;
+			}
+
+			inline void AppendHead(std::string& buffer, MajorType major, uint64_t argument)
+			{
+				char bytes[kMaxHeadSize];
+				buffer.append(bytes, EncodeHead(major, argument, bytes));
+			}
+
+			// Reads a head with a definite argument. Indefinite lengths are not accepted since
+			// deterministic encoding does not produce them.
+			inline bool ReadHead(std::string_view input, size_t& position, MajorType& major, uint64_t& argument)
+			{
+				bool success = false;
+				if (position < input.size())
+				{
+					const uint8_t initial = static_cast<uint8_t>(input[position]);
+					const uint8_t additional = initial & 0x1F;
+					major = static_cast<MajorType>(initial >> 5);
+
+					size_t argumentSize = 0;
+					switch (additional)
+					{
+					case kArgument8: argumentSize = 1; break;
+					case kArgument16: argumentSize = 2; break;
+					case kArgument32: argumentSize = 4; break;
+					case kArgument64: argumentSize = 8; break;
+					default: break;
+					}
+
+					if (additional <= kArgumentInline)
+					{
+						argument = additional;
+						position += 1;
+						success = true;
+					}
+					else if (argumentSize > 0 && input.size() - position > argumentSize)
+					{
+						argument = 0;
+						for (size_t i = 0; i < argumentSize; ++i)
+						{
+							argument = (argument << 8) | static_cast<uint8_t>(input[position + 1 + i]);
+						}
+						position += 1 + argumentSize;
+						success = true;
+					}
+				}
+				return success;
+			}
+
+			// Half precision bits of a float, when the conversion is exact
+			inline bool FloatToHalf(float value, uint16_t& half)
+			{
+				uint32_t bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+				const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127;
+				const uint32_t mantissa = bits & 0x7FFFFF;
+
+				bool exact = false;
+				if (exponent == 128 && mantissa == 0)
+				{
+					// Infinities
+					half = sign | 0x7C00;
+					exact = true;
+				}
+				else if (exponent == -127 && mantissa == 0)
+				{
+					// Zeros
+					half = sign;
+					exact = true;
+				}
+				else if (exponent >= -14 && exponent <= 15 && (mantissa & 0x1FFF) == 0)
+				{
+					half = static_cast<uint16_t>(sign | ((exponent + 15) << 10) | (mantissa >> 13));
+					exact = true;
+				}
+				else if (exponent >= -24 && exponent < -14)
+				{
+					// Half precision subnormals, in steps of 2^-24
+					const uint32_t significand = mantissa | 0x800000;
+					const uint32_t shift = static_cast<uint32_t>(-exponent - 1);
+					if ((significand & ((1u << shift) - 1)) == 0)
+					{
+						half = static_cast<uint16_t>(sign | (significand >> shift));
+						exact = true;
+					}
+				}
+				return exact;
+			}
+
+			inline double HalfToDouble(uint16_t half)
+			{
+				const int32_t exponent = (half >> 10) & 0x1F;
+				const int32_t mantissa = half & 0x3FF;
+				double value = 0;
+				if (exponent == 0)
+				{
+					value = std::ldexp(mantissa, -24);
+				}
+				else if (exponent == 31)
+				{
+					value = mantissa == 0 ? INFINITY : NAN;
+				}
+				else
+				{
+					value = std::ldexp(mantissa + 1024, exponent - 25);
+				}
+				return (half & 0x8000) ? -value : value;
+			}
+		}
+	}
+}
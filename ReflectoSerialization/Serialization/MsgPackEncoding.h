@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Type bytes of the MessagePack specification and big endian primitives shared by the
+		// MessagePack writer and reader
+		namespace MsgPackEncoding
+		{
+			constexpr uint8_t kPositiveFixIntMax = 0x7F;
+			constexpr uint8_t kFixMap = 0x80;
+			constexpr uint8_t kFixArray = 0x90;
+			constexpr uint8_t kFixStr = 0xA0;
+			constexpr uint8_t kNil = 0xC0;
+			constexpr uint8_t kFalse = 0xC2;
+			constexpr uint8_t kTrue = 0xC3;
+			constexpr uint8_t kBin8 = 0xC4;
+			constexpr uint8_t kBin16 = 0xC5;
+			constexpr uint8_t kBin32 = 0xC6;
+			constexpr uint8_t kFloat32 = 0xCA;
+			constexpr uint8_t kFloat64 = 0xCB;
+			constexpr uint8_t kUInt8 = 0xCC;
+			constexpr uint8_t kUInt16 = 0xCD;
+			constexpr uint8_t kUInt32 = 0xCE;
+			constexpr uint8_t kUInt64 = 0xCF;
+			constexpr uint8_t kInt8 = 0xD0;
+			constexpr uint8_t kInt16 = 0xD1;
+			constexpr uint8_t kInt32 = 0xD2;
+			constexpr uint8_t kInt64 = 0xD3;
+			constexpr uint8_t kStr8 = 0xD9;
+			constexpr uint8_t kStr16 = 0xDA;
+			constexpr uint8_t kStr32 = 0xDB;
+			constexpr uint8_t kArray16 = 0xDC;
+			constexpr uint8_t kArray32 = 0xDD;
+			constexpr uint8_t kMap16 = 0xDE;
+			constexpr uint8_t kMap32 = 0xDF;
+			constexpr uint8_t kNegativeFixIntMin = 0xE0;
+
+			constexpr uint32_t kFixStrMaxSize = 31;
+			constexpr uint32_t kFixContainerMaxSize = 15;
+			constexpr size_t kMaxHeaderSize = 5;
+
+			template<typename value_t>
+			using bits_t = std::conditional_t<sizeof(value_t) == 8, uint64_t, std::conditional_t<sizeof(value_t) == 4, uint32_t, std::conditional_t<sizeof(value_t) == 2, uint16_t, uint8_t>>>;
+
+			// Writes into bytes and returns the size written
+			template<typename value_t>
+			size_t EncodeBigEndian(value_t value, char* bytes)
+			{
+				bits_t<value_t> bits;
+				std::memcpy(&bits, &value, sizeof(value_t));
+				for (size_t i = 0; i < sizeof(value_t); ++i)
+				{
+					bytes[i] = static_cast<char>(bits >> (8 * (sizeof(value_t) - 1 - i)));
+				}
+				return sizeof(value_t);
+			}
+
+			// Type byte followed by the big endian value
+			template<typename value_t>
+			void AppendTyped(std::string& buffer, uint8_t type, value_t value)
+			{
+				char bytes[1 + sizeof(value_t)];
+				bytes[0] = static_cast<char>(type);
+				buffer.append(bytes, 1 + EncodeBigEndian(value, bytes + 1));
+			}
+
+			template<typename value_t>
+			bool ReadBigEndian(std::string_view input, size_t& position, value_t& value)
+			{
+				bool success = false;
+				if (input.size() - position >= sizeof(value_t))
+				{
+					bits_t<value_t> bits = 0;
+					for (size_t i = 0; i < sizeof(value_t); ++i)
+					{
+						bits = static_cast<bits_t<value_t>>((bits << 8) | static_cast<uint8_t>(input[position + i]));
+					}
+					std::memcpy(&value, &bits, sizeof(value_t));
+					position += sizeof(value_t);
+					success = true;
+				}
+				return success;
+			}
+
+			// Array or map header with the smallest encoding for the count. Writes into bytes,
+			// which must hold kMaxHeaderSize, and returns the size written.
+			inline size_t EncodeContainerHeader(bool map, uint32_t count, char* bytes)
+			{
+				size_t size = 1;
+				if (count <= kFixContainerMaxSize)
+				{
+					bytes[0] = static_cast<char>((map ? kFixMap : kFixArray) | count);
+				}
+				else if (count <= UINT16_MAX)
+				{
+					bytes[0] = static_cast<char>(map ? kMap16 : kArray16);
+					size += EncodeBigEndian(static_cast<uint16_t>(count), bytes + 1);
+				}
+				else
+				{
+					bytes[0] = static_cast<char>(map ? kMap32 : kArray32);
+					size += EncodeBigEndian(count, bytes + 1);
+				}
+				return size;
+			}
+		}
+	}
+}
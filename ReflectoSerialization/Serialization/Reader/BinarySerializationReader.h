@@ -0,0 +1,329 @@
+#pragma once
+
+#include "Serialization/BinaryEncoding.h"
+#include "Serialization/Reader/ISerializationReader.h"
+
+#include "Utils/IOExt.h"
+
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Reads the binary encoding of BinarySerializationWriter, with the same property format it
+		// was written with. Values carry no type tag, so each must be read with the type it was
+		// written with and every property value must be read, since there is nothing to skip by.
+		class BinarySerializationReader : public ISerializationReader
+		{
+		public:
+			BinarySerializationReader()
+				: BinarySerializationReader(BinaryPropertyFormat::Name)
+			{ }
+
+			BinarySerializationReader(BinaryPropertyFormat propertyFormat)
+				: _propertyFormat(propertyFormat)
+			{ }
+
+			virtual bool ReadInteger32(int32_t& value) override
+			{
+				return BinaryEncoding::ReadFixed(_input, _position, value);
+			}
+
+			virtual bool ReadUnsignedInteger32(uint32_t& value) override
+			{
+				return BinaryEncoding::ReadFixed(_input, _position, value);
+			}
+
+			virtual bool ReadInteger64(int64_t& value) override
+			{
+				return BinaryEncoding::ReadFixed(_input, _position, value);
+			}
+
+			virtual bool ReadFloat(float& value) override
+			{
+				return BinaryEncoding::ReadFixed(_input, _position, value);
+			}
+
+			virtual bool ReadDouble(double& value) override
+			{
+				return BinaryEncoding::ReadFixed(_input, _position, value);
+			}
+
+			virtual bool ReadString(std::string& value) override
+			{
+				std::string_view view;
+				const bool success = ReadStringView(view);
+				if (success)
+				{
+					value.assign(view);
+				}
+				return success;
+			}
+
+			// View into the input, valid for as long as the input is
+			bool ReadStringView(std::string_view& value)
+			{
+				return BinaryEncoding::ReadString(_input, _position, value);
+			}
+
+			virtual bool ReadBytes(std::string& bytes) override
+			{
+				return ReadString(bytes);
+			}
+
+			virtual bool ReadBoolean(bool& value) override
+			{
+				uint8_t byte = 0;
+				const bool success = BinaryEncoding::ReadFixed(_input, _position, byte) && byte <= 1;
+				value = byte == 1;
+				return success;
+			}
+
+			// Tags are only consumed when they match, to leave the input as is on failure
+			virtual bool ReadNull(void* value) override
+			{
+				return ReadTag(BinaryEncoding::kNullTag);
+			}
+
+			virtual bool ReadPresent() override
+			{
+				return ReadTag(BinaryEncoding::kPresentTag);
+			}
+
+			virtual bool ReadBeginObject() override
+			{
+				return BeginFrame(FrameKind::Object);
+			}
+
+			virtual bool ReadEndObject() override
+			{
+				return EndFrame(FrameKind::Object);
+			}
+
+			virtual bool HasObjectPropertyRemaining() override
+			{
+				return HasRemaining(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginObjectProperty(std::string& propertyName) override
+			{
+				std::string_view view;
+				const bool success = ReadBeginObjectProperty(view);
+				if (success)
+				{
+					propertyName.assign(view);
+				}
+				return success;
+			}
+
+			bool ReadBeginObjectProperty(std::string_view& propertyName)
+			{
+				bool success = false;
+				if (BeginEntry(FrameKind::Object))
+				{
+					if (_propertyFormat == BinaryPropertyFormat::Index)
+					{
+						// Index one past the known names introduces a new name
+						uint64_t index = 0;
+						if (BinaryEncoding::ReadVarint(_input, _position, index) && index <= _propertyNames.size())
+						{
+							if (index == _propertyNames.size())
+							{
+								success = BinaryEncoding::ReadString(_input, _position, propertyName);
+								_propertyNames.push_back(propertyName);
+							}
+							else
+							{
+								propertyName = _propertyNames[static_cast<size_t>(index)];
+								success = true;
+							}
+						}
+					}
+					else
+					{
+						success = BinaryEncoding::ReadString(_input, _position, propertyName);
+					}
+				}
+				return success;
+			}
+
+			virtual bool ReadEndObjectProperty() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Object;
+			}
+
+			virtual bool ReadBeginArray() override
+			{
+				return BeginFrame(FrameKind::Array);
+			}
+
+			virtual bool ReadEndArray() override
+			{
+				return EndFrame(FrameKind::Array);
+			}
+
+			virtual bool HasArrayElementRemaining() override
+			{
+				return HasRemaining(FrameKind::Array);
+			}
+
+			virtual bool ReadBeginArrayElement(uint32_t& index) override
+			{
+				bool success = false;
+				if (!_frames.empty())
+				{
+					index = _frames.back().read;
+					success = BeginEntry(FrameKind::Array);
+				}
+				return success;
+			}
+
+			virtual bool ReadEndArrayElement() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Array;
+			}
+
+			// Elements are fixed size, so number arrays are read as one block
+			virtual bool ReadInteger32Array(std::vector<int32_t>& values) override
+			{
+				return ReadFixedArray(values);
+			}
+
+			virtual bool ReadUnsignedInteger32Array(std::vector<uint32_t>& values) override
+			{
+				return ReadFixedArray(values);
+			}
+
+			virtual bool ReadFloatArray(std::vector<float>& values) override
+			{
+				return ReadFixedArray(values);
+			}
+
+			virtual bool ReadDoubleArray(std::vector<double>& values) override
+			{
+				return ReadFixedArray(values);
+			}
+
+			// Reads the whole stream into a buffer owned by the reader
+			bool Import(std::istream& inputStream)
+			{
+				_ownedInput.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+				return Import(std::string_view(_ownedInput));
+			}
+
+			// Maps the file in memory for as long as the reader reads it
+			bool ImportFile(const std::string& file)
+			{
+				return IOExt::MapFile(file, _mappedInput) && Import(_mappedInput.GetView());
+			}
+
+			// Reads from a buffer that must outlive the reads
+			bool Import(std::string_view input)
+			{
+				_input = input;
+				_position = 0;
+				_frames.clear();
+				_propertyNames.clear();
+				return !_input.empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				uint32_t count;
+				uint32_t read;
+			};
+
+			template<typename value_t>
+			bool ReadFixedArray(std::vector<value_t>& values)
+			{
+				bool success = false;
+				if (BeginFrame(FrameKind::Array))
+				{
+					// The count is checked against the input before anything is allocated
+					Frame& frame = _frames.back();
+					if ((_input.size() - _position) / sizeof(value_t) >= frame.count)
+					{
+						const size_t first = values.size();
+						values.resize(first + frame.count);
+						success = BinaryEncoding::ReadFixedArray(_input, _position, values.data() + first, frame.count);
+						frame.read = frame.count;
+					}
+					success &= EndFrame(FrameKind::Array);
+				}
+				return success;
+			}
+
+			bool ReadTag(char tag)
+			{
+				const bool success = _position < _input.size() && _input[_position] == tag;
+				if (success)
+				{
+					++_position;
+				}
+				return success;
+			}
+
+			bool BeginFrame(FrameKind kind)
+			{
+				bool success = false;
+				uint64_t count = 0;
+				if (BinaryEncoding::ReadVarint(_input, _position, count) && count <= std::numeric_limits<uint32_t>::max())
+				{
+					_frames.push_back(Frame{ kind, static_cast<uint32_t>(count), 0 });
+					success = true;
+				}
+				return success;
+			}
+
+			bool EndFrame(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind && _frames.back().read == _frames.back().count)
+				{
+					_frames.pop_back();
+					success = true;
+				}
+				return success;
+			}
+
+			bool HasRemaining(FrameKind kind) const
+			{
+				return !_frames.empty() && _frames.back().kind == kind && _frames.back().read < _frames.back().count;
+			}
+
+			bool BeginEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (HasRemaining(kind))
+				{
+					++_frames.back().read;
+					success = true;
+				}
+				return success;
+			}
+
+			BinaryPropertyFormat _propertyFormat;
+			std::string _ownedInput;
+			IOExt::MappedFile _mappedInput;
+			std::string_view _input;
+			size_t _position = 0;
+			std::vector<Frame> _frames;
+			std::vector<std::string_view> _propertyNames;
+		};
+	}
+}
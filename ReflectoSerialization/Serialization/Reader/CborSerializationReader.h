@@ -0,0 +1,402 @@
+#pragma once
+
+#include "Serialization/CborEncoding.h"
+#include "Serialization/Reader/ISerializationReader.h"
+
+#include "Utils/IOExt.h"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Reads CBOR in place from a contiguous buffer. Integers are read when their value fits the
+		// requested type, floats and doubles from any float precision. Objects are maps keyed by
+		// text strings. Indefinite lengths and tags are not supported. A property whose value is
+		// not read is skipped when it ends, and a value that fails to read leaves the cursor where
+		// it was.
+		class CborSerializationReader : public ISerializationReader
+		{
+		public:
+			virtual bool ReadInteger32(int32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadUnsignedInteger32(uint32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadInteger64(int64_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadFloat(float& value) override
+			{
+				double real = 0;
+				const bool success = ReadDouble(real);
+				if (success)
+				{
+					value = static_cast<float>(real);
+				}
+				return success;
+			}
+
+			virtual bool ReadDouble(double& value) override
+			{
+				bool success = false;
+				size_t position = _position;
+				CborEncoding::MajorType major;
+				uint64_t bits = 0;
+				const uint8_t type = PeekType();
+				if (CborEncoding::ReadHead(_input, position, major, bits))
+				{
+					if (type == CborEncoding::kFloat16)
+					{
+						value = CborEncoding::HalfToDouble(static_cast<uint16_t>(bits));
+						success = true;
+					}
+					else if (type == CborEncoding::kFloat32)
+					{
+						float single = 0;
+						const uint32_t bits32 = static_cast<uint32_t>(bits);
+						std::memcpy(&single, &bits32, sizeof(single));
+						value = single;
+						success = true;
+					}
+					else if (type == CborEncoding::kFloat64)
+					{
+						std::memcpy(&value, &bits, sizeof(value));
+						success = true;
+					}
+				}
+				return success && ConsumeValue(position);
+			}
+
+			virtual bool ReadString(std::string& value) override
+			{
+				std::string_view view;
+				const bool success = ReadStringView(view);
+				if (success)
+				{
+					value.assign(view);
+				}
+				return success;
+			}
+
+			// View into the input, valid for as long as the input is
+			bool ReadStringView(std::string_view& value)
+			{
+				size_t position = _position;
+				return ParseString(CborEncoding::MajorType::TextString, position, value) && ConsumeValue(position);
+			}
+
+			virtual bool ReadBytes(std::string& bytes) override
+			{
+				std::string_view view;
+				const bool success = ReadBytesView(view);
+				if (success)
+				{
+					bytes.assign(view);
+				}
+				return success;
+			}
+
+			// Bytes written as a byte string, viewed in the input
+			bool ReadBytesView(std::string_view& value)
+			{
+				size_t position = _position;
+				return ParseString(CborEncoding::MajorType::ByteString, position, value) && ConsumeValue(position);
+			}
+
+			virtual bool ReadBoolean(bool& value) override
+			{
+				const uint8_t type = PeekType();
+				const bool success = (type == CborEncoding::kTrue || type == CborEncoding::kFalse) && ConsumeValue(_position + 1);
+				value = type == CborEncoding::kTrue;
+				return success;
+			}
+
+			virtual bool ReadNull(void* value) override
+			{
+				return PeekType() == CborEncoding::kNull && ConsumeValue(_position + 1);
+			}
+
+			virtual bool ReadBeginObject() override
+			{
+				return BeginFrame(FrameKind::Object);
+			}
+
+			virtual bool ReadEndObject() override
+			{
+				return EndFrame(FrameKind::Object);
+			}
+
+			virtual bool HasObjectPropertyRemaining() override
+			{
+				return HasRemaining(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginObjectProperty(std::string& propertyName) override
+			{
+				std::string_view view;
+				const bool success = ReadBeginObjectProperty(view);
+				if (success)
+				{
+					propertyName.assign(view);
+				}
+				return success;
+			}
+
+			bool ReadBeginObjectProperty(std::string_view& propertyName)
+			{
+				bool success = false;
+				size_t position = _position;
+				if (HasRemaining(FrameKind::Object) && ParseString(CborEncoding::MajorType::TextString, position, propertyName))
+				{
+					_position = position;
+					BeginEntry();
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadEndObjectProperty() override
+			{
+				return EndEntry(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginArray() override
+			{
+				return BeginFrame(FrameKind::Array);
+			}
+
+			virtual bool ReadEndArray() override
+			{
+				return EndFrame(FrameKind::Array);
+			}
+
+			virtual bool HasArrayElementRemaining() override
+			{
+				return HasRemaining(FrameKind::Array);
+			}
+
+			virtual bool ReadBeginArrayElement(uint32_t& index) override
+			{
+				bool success = false;
+				if (HasRemaining(FrameKind::Array))
+				{
+					index = static_cast<uint32_t>(_frames.back().read);
+					BeginEntry();
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadEndArrayElement() override
+			{
+				return EndEntry(FrameKind::Array);
+			}
+
+			// Reads the whole stream into a buffer owned by the reader
+			bool Import(std::istream& inputStream)
+			{
+				_ownedInput.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+				return Import(std::string_view(_ownedInput));
+			}
+
+			// Maps the file in memory for as long as the reader reads it
+			bool ImportFile(const std::string& file)
+			{
+				return IOExt::MapFile(file, _mappedInput) && Import(_mappedInput.GetView());
+			}
+
+			// Reads from a buffer that must outlive the reads
+			bool Import(std::string_view input)
+			{
+				_input = input;
+				_position = 0;
+				_frames.clear();
+				return !_input.empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				bool pendingValue;
+				uint64_t count;
+				uint64_t read;
+			};
+
+			template<typename integer_t>
+			bool ReadInteger(integer_t& value)
+			{
+				bool success = false;
+				size_t position = _position;
+				CborEncoding::MajorType major;
+				uint64_t argument = 0;
+				if (CborEncoding::ReadHead(_input, position, major, argument))
+				{
+					if (major == CborEncoding::MajorType::UnsignedInteger && argument <= static_cast<uint64_t>(std::numeric_limits<integer_t>::max()))
+					{
+						value = static_cast<integer_t>(argument);
+						success = true;
+					}
+					else if constexpr (std::is_signed_v<integer_t>)
+					{
+						// The value is -1 - argument
+						if (major == CborEncoding::MajorType::NegativeInteger && argument <= static_cast<uint64_t>(-(static_cast<int64_t>(std::numeric_limits<integer_t>::min()) + 1)))
+						{
+							value = static_cast<integer_t>(-1 - static_cast<int64_t>(argument));
+							success = true;
+						}
+					}
+				}
+				return success && ConsumeValue(position);
+			}
+
+			bool ParseString(CborEncoding::MajorType expected, size_t& position, std::string_view& value)
+			{
+				bool success = false;
+				CborEncoding::MajorType major;
+				uint64_t size = 0;
+				if (CborEncoding::ReadHead(_input, position, major, size) && major == expected && size <= _input.size() - position)
+				{
+					value = _input.substr(position, static_cast<size_t>(size));
+					position += static_cast<size_t>(size);
+					success = true;
+				}
+				return success;
+			}
+
+			uint8_t PeekType() const
+			{
+				return _position < _input.size() ? static_cast<uint8_t>(_input[_position]) : 0;
+			}
+
+			bool ConsumeValue(size_t position)
+			{
+				_position = position;
+				if (!_frames.empty())
+				{
+					_frames.back().pendingValue = false;
+				}
+				return true;
+			}
+
+			bool BeginFrame(FrameKind kind)
+			{
+				bool success = false;
+				size_t position = _position;
+				CborEncoding::MajorType major;
+				uint64_t count = 0;
+				const CborEncoding::MajorType expected = kind == FrameKind::Object ? CborEncoding::MajorType::Map : CborEncoding::MajorType::Array;
+				if (CborEncoding::ReadHead(_input, position, major, count) && major == expected)
+				{
+					ConsumeValue(position);
+					_frames.push_back(Frame{ kind, false, count, 0 });
+					success = true;
+				}
+				return success;
+			}
+
+			bool EndFrame(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind && _frames.back().read == _frames.back().count)
+				{
+					_frames.pop_back();
+					success = true;
+				}
+				return success;
+			}
+
+			bool HasRemaining(FrameKind kind) const
+			{
+				return !_frames.empty() && _frames.back().kind == kind && _frames.back().read < _frames.back().count;
+			}
+
+			void BeginEntry()
+			{
+				++_frames.back().read;
+				_frames.back().pendingValue = true;
+			}
+
+			bool EndEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					// Value of the entry was not read by the caller
+					success = !_frames.back().pendingValue || SkipValue();
+					_frames.back().pendingValue = false;
+				}
+				return success;
+			}
+
+			// Skips a value and everything nested in it by counting the values left to skip
+			bool SkipValue()
+			{
+				bool success = true;
+				uint64_t remaining = 1;
+				while (success && remaining > 0)
+				{
+					--remaining;
+					CborEncoding::MajorType major;
+					uint64_t argument = 0;
+					success = CborEncoding::ReadHead(_input, _position, major, argument);
+					if (success)
+					{
+						switch (major)
+						{
+						case CborEncoding::MajorType::ByteString:
+						case CborEncoding::MajorType::TextString:
+							success = argument <= _input.size() - _position;
+							_position += success ? static_cast<size_t>(argument) : 0;
+							break;
+						case CborEncoding::MajorType::Array:
+							// Each entry takes at least a byte, which bounds counts before they add up
+							success = argument <= _input.size() - _position;
+							remaining += argument;
+							break;
+						case CborEncoding::MajorType::Map:
+							success = argument <= _input.size() - _position;
+							remaining += 2 * argument;
+							break;
+						case CborEncoding::MajorType::Tag:
+							success = false;
+							break;
+						default:
+							break;
+						}
+					}
+				}
+				return success;
+			}
+
+			std::string _ownedInput;
+			IOExt::MappedFile _mappedInput;
+			std::string_view _input;
+			size_t _position = 0;
+			std::vector<Frame> _frames;
+		};
+	}
+}
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Reflecto
 {
@@ -22,10 +23,19 @@ namespace Reflecto
 
 			virtual bool ReadString(std::string& value) = 0;
 
+			// Raw bytes as written by WriteBytes, replacing the content of bytes
+			virtual bool ReadBytes(std::string& bytes) = 0;
+
 			virtual bool ReadBoolean(bool& value) = 0;
 
 			virtual bool ReadNull(void* value) = 0;
 
+			// Read before the value of an optional that has one, as written by WritePresent
+			virtual bool ReadPresent()
+			{
+				return true;
+			}
+
 			virtual bool ReadBeginObject() = 0;
 
 			virtual bool ReadEndObject() = 0;
@@ -45,6 +55,46 @@ namespace Reflecto
 			virtual bool ReadBeginArrayElement(uint32_t& index) = 0;
 
 			virtual bool ReadEndArrayElement() = 0;
+
+			// Arrays of numbers read at once and appended to values. Readers override these
+			// when they can do better than one element at a time.
+			virtual bool ReadInteger32Array(std::vector<int32_t>& values)
+			{
+				return ReadNumberArray(values, &ISerializationReader::ReadInteger32);
+			}
+
+			virtual bool ReadUnsignedInteger32Array(std::vector<uint32_t>& values)
+			{
+				return ReadNumberArray(values, &ISerializationReader::ReadUnsignedInteger32);
+			}
+
+			virtual bool ReadFloatArray(std::vector<float>& values)
+			{
+				return ReadNumberArray(values, &ISerializationReader::ReadFloat);
+			}
+
+			virtual bool ReadDoubleArray(std::vector<double>& values)
+			{
+				return ReadNumberArray(values, &ISerializationReader::ReadDouble);
+			}
+
+		private:
+			template<typename number_t>
+			bool ReadNumberArray(std::vector<number_t>& values, bool (ISerializationReader::*read)(number_t&))
+			{
+				bool success = true;
+				success &= ReadBeginArray();
+				while (HasArrayElementRemaining())
+				{
+					uint32_t index;
+					success &= ReadBeginArrayElement(index);
+					values.emplace_back();
+					success &= (this->*read)(values.back());
+					success &= ReadEndArrayElement();
+				}
+				success &= ReadEndArray();
+				return success;
+			}
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,452 @@
+#pragma once
+
+#include "Serialization/Base64Encoding.h"
+#include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/Reader/JsonStructuralIndex.h"
+#include "Serialization/Reader/JsonToken.h"
+
+#include "Utils/IOExt.h"
+
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Reads JSON in two stages. Import builds a structural index of the whole input, then reads
+		// walk that index instead of scanning characters: strings span from a quote to the next
+		// indexed quote, numbers and literals end where the next indexed position starts and
+		// unread values are skipped by counting brackets in the index. Values are typed and
+		// properties are read like JsonStreamSerializationReader. Comments are not supported.
+		class JsonIndexedSerializationReader : public ISerializationReader
+		{
+		public:
+			virtual bool ReadInteger32(int32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadUnsignedInteger32(uint32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadInteger64(int64_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadFloat(float& value) override
+			{
+				return ReadReal(value);
+			}
+
+			virtual bool ReadDouble(double& value) override
+			{
+				return ReadReal(value);
+			}
+
+			virtual bool ReadString(std::string& value) override
+			{
+				std::string_view view;
+				const bool success = ReadStringView(view);
+				if (success)
+				{
+					value.assign(view);
+				}
+				return success;
+			}
+
+			// Strings without escapes are views into the input, others are decoded into a buffer
+			// of the reader. Either way the view is valid until the next read.
+			bool ReadStringView(std::string_view& value)
+			{
+				bool success = false;
+				if (ParseString(value))
+				{
+					MarkValueRead();
+					success = true;
+				}
+				return success;
+			}
+
+			// Base64 text decoded into the bytes
+			virtual bool ReadBytes(std::string& bytes) override
+			{
+				std::string_view text;
+				return ReadStringView(text) && Base64Encoding::Decode(text, bytes);
+			}
+
+			virtual bool ReadBoolean(bool& value) override
+			{
+				bool success = false;
+				const std::string_view atom = PeekAtom();
+				if (atom == "true" || atom == "false")
+				{
+					value = atom == "true";
+					ConsumeValue(1);
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadNull(void* value) override
+			{
+				bool success = false;
+				if (PeekAtom() == "null")
+				{
+					ConsumeValue(1);
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadBeginObject() override
+			{
+				return BeginFrame('{', FrameKind::Object);
+			}
+
+			virtual bool ReadEndObject() override
+			{
+				return EndFrame('}', FrameKind::Object);
+			}
+
+			virtual bool HasObjectPropertyRemaining() override
+			{
+				return HasRemaining('}', FrameKind::Object);
+			}
+
+			virtual bool ReadBeginObjectProperty(std::string& propertyName) override
+			{
+				std::string_view view;
+				const bool success = ReadBeginObjectProperty(view);
+				if (success)
+				{
+					propertyName.assign(view);
+				}
+				return success;
+			}
+
+			bool ReadBeginObjectProperty(std::string_view& propertyName)
+			{
+				bool success = false;
+				if (BeginEntry(FrameKind::Object) && ParseString(propertyName) && Expect(':'))
+				{
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadEndObjectProperty() override
+			{
+				return EndEntry(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginArray() override
+			{
+				return BeginFrame('[', FrameKind::Array);
+			}
+
+			virtual bool ReadEndArray() override
+			{
+				return EndFrame(']', FrameKind::Array);
+			}
+
+			virtual bool HasArrayElementRemaining() override
+			{
+				return HasRemaining(']', FrameKind::Array);
+			}
+
+			virtual bool ReadBeginArrayElement(uint32_t& index) override
+			{
+				bool success = false;
+				if (!_frames.empty())
+				{
+					index = _frames.back().count;
+					success = BeginEntry(FrameKind::Array);
+				}
+				return success;
+			}
+
+			virtual bool ReadEndArrayElement() override
+			{
+				return EndEntry(FrameKind::Array);
+			}
+
+			// Reads the whole stream into a buffer owned by the reader
+			bool Import(std::istream& inputStream)
+			{
+				_ownedInput.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+				return Import(std::string_view(_ownedInput));
+			}
+
+			// Maps the file in memory for as long as the reader reads it
+			bool ImportFile(const std::string& file)
+			{
+				return IOExt::MapFile(file, _mappedInput) && Import(_mappedInput.GetView());
+			}
+
+			// Indexes a buffer that must outlive the reads
+			bool Import(std::string_view input)
+			{
+				return Import(input, JsonStructuralIndex::GetBestImplementation());
+			}
+
+			bool Import(std::string_view input, JsonStructuralIndex::Implementation implementation)
+			{
+				// Byte order mark is ignored
+				constexpr std::string_view kByteOrderMark = "\xEF\xBB\xBF";
+				if (input.substr(0, kByteOrderMark.size()) == kByteOrderMark)
+				{
+					input.remove_prefix(kByteOrderMark.size());
+				}
+
+				_input = input;
+				_next = 0;
+				_frames.clear();
+				_failed = false;
+				return _index.Build(input, implementation) && !_index.GetPositions().empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				bool pendingValue;
+				uint32_t count;
+			};
+
+			template<typename integer_t>
+			bool ReadInteger(integer_t& value)
+			{
+				bool success = false;
+				if (JsonToken::ParseInteger(PeekAtom(), value))
+				{
+					ConsumeValue(1);
+					success = true;
+				}
+				return success;
+			}
+
+			template<typename real_t>
+			bool ReadReal(real_t& value)
+			{
+				bool success = false;
+				if (JsonToken::ParseReal(PeekAtom(), value))
+				{
+					ConsumeValue(1);
+					success = true;
+				}
+				return success;
+			}
+
+			// Character at the next indexed position, or 0 past the last one
+			char Peek() const
+			{
+				const std::vector<uint32_t>& positions = _index.GetPositions();
+				return _next < positions.size() ? _input[positions[_next]] : '\0';
+			}
+
+			// Number or literal at the next indexed position. It ends at the following indexed
+			// position, less the whitespace in between.
+			std::string_view PeekAtom() const
+			{
+				std::string_view atom;
+				const char c = Peek();
+				if (c != '\0' && c != '"' && !IsStructural(c))
+				{
+					const std::vector<uint32_t>& positions = _index.GetPositions();
+					const size_t start = positions[_next];
+					size_t end = _next + 1 < positions.size() ? positions[_next + 1] : _input.size();
+					while (end > start && IsWhitespace(_input[end - 1]))
+					{
+						--end;
+					}
+					atom = _input.substr(start, end - start);
+				}
+				return atom;
+			}
+
+			void ConsumeValue(size_t positionCount)
+			{
+				_next += positionCount;
+				MarkValueRead();
+			}
+
+			void MarkValueRead()
+			{
+				if (!_frames.empty())
+				{
+					_frames.back().pendingValue = false;
+				}
+			}
+
+			bool BeginFrame(char open, FrameKind kind)
+			{
+				bool success = false;
+				if (Expect(open))
+				{
+					MarkValueRead();
+					_frames.push_back(Frame{ kind, false, 0 });
+					success = true;
+				}
+				return success;
+			}
+
+			bool EndFrame(char close, FrameKind kind)
+			{
+				bool success = false;
+				if (!_failed && !_frames.empty() && _frames.back().kind == kind && Expect(close))
+				{
+					_frames.pop_back();
+					success = true;
+				}
+				return success;
+			}
+
+			// Anything but a separator or the closer after an entry is malformed, the failure is
+			// kept so that loops over the entries stop and the end of the container fails
+			bool HasRemaining(char close, FrameKind kind)
+			{
+				bool remaining = false;
+				if (!_failed && !_frames.empty() && _frames.back().kind == kind)
+				{
+					const char c = Peek();
+					remaining = c != close && c != '\0';
+					_failed = _frames.back().count > 0 && c != close && c != ',';
+					remaining &= !_failed;
+				}
+				return remaining;
+			}
+
+			bool BeginEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					Frame& frame = _frames.back();
+					if (frame.count == 0 || Expect(','))
+					{
+						++frame.count;
+						frame.pendingValue = true;
+						success = true;
+					}
+				}
+				_failed |= !success;
+				return success;
+			}
+
+			bool EndEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					// Value of the entry was not read by the caller
+					success = !_frames.back().pendingValue || SkipValue();
+					_frames.back().pendingValue = false;
+				}
+				_failed |= !success;
+				return success;
+			}
+
+			// Strings take two positions, their quotes, so only brackets need to be looked at
+			bool SkipValue()
+			{
+				bool success = false;
+				const std::vector<uint32_t>& positions = _index.GetPositions();
+				const char c = Peek();
+				if (c == '"')
+				{
+					_next += 2;
+					success = _next <= positions.size();
+				}
+				else if (c == '{' || c == '[')
+				{
+					uint32_t depth = 0;
+					do
+					{
+						const char current = _input[positions[_next]];
+						depth += current == '{' || current == '[';
+						depth -= current == '}' || current == ']';
+						++_next;
+					} while (depth > 0 && _next < positions.size());
+					success = depth == 0;
+				}
+				else if (c != '\0' && !IsStructural(c))
+				{
+					// Atoms run to the next structural character, so two values missing their
+					// separator would be skipped as one
+					const std::string_view atom = PeekAtom();
+					success = atom == "true" || atom == "false" || atom == "null" || JsonToken::FindNumber(atom).size() == atom.size();
+					_next += success ? 1 : 0;
+				}
+				return success;
+			}
+
+			bool Expect(char c)
+			{
+				bool success = false;
+				if (Peek() == c)
+				{
+					++_next;
+					success = true;
+				}
+				return success;
+			}
+
+			bool ParseString(std::string_view& value)
+			{
+				bool success = false;
+				const std::vector<uint32_t>& positions = _index.GetPositions();
+				if (Peek() == '"' && _next + 1 < positions.size())
+				{
+					const size_t start = positions[_next] + 1;
+					const std::string_view content = _input.substr(start, positions[_next + 1] - start);
+					if (content.find('\\') == std::string_view::npos)
+					{
+						value = content;
+						success = true;
+					}
+					else
+					{
+						_decoded.clear();
+						success = JsonToken::Unescape(content, _decoded);
+						value = _decoded;
+					}
+					_next += success ? 2 : 0;
+				}
+				return success;
+			}
+
+			static bool IsStructural(char c)
+			{
+				return c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+			}
+
+			static bool IsWhitespace(char c)
+			{
+				return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+			}
+
+			std::string _ownedInput;
+			IOExt::MappedFile _mappedInput;
+			std::string_view _input;
+			JsonStructuralIndex _index;
+			std::string _decoded;
+			size_t _next = 0;
+			std::vector<Frame> _frames;
+			bool _failed = false;
+		};
+	}
+}
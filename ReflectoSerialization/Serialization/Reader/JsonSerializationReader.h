@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Serialization/Base64Encoding.h"
 #include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/Reader/JsonToken.h"
 
 #include "Common/Definitions.h"
 #include "Common/Ensure.h"
@@ -26,23 +28,25 @@ namespace Reflecto
 
 			virtual bool ReadInteger32(int32_t& value) override
 			{
-				return ReadElementValue(Json::intValue, &Json::Value::asInt, value);
+				return ReadIntegerValue(&Json::Value::isInt, &Json::Value::asInt, value);
 			}
 
 			virtual bool ReadUnsignedInteger32(uint32_t& value) override
 			{
-				return ReadElementValue(Json::uintValue, &Json::Value::asUInt, value)
-				|| ReadElementValue(Json::intValue, &Json::Value::asInt, value);
+				return ReadIntegerValue(&Json::Value::isUInt, &Json::Value::asUInt, value);
 			}
 
 			virtual bool ReadInteger64(int64_t& value) override
 			{
-				return ReadElementValue(Json::intValue, &Json::Value::asInt64, value);
+				return ReadIntegerValue(&Json::Value::isInt64, &Json::Value::asInt64, value);
 			}
 
 			virtual bool ReadFloat(float& value) override
 			{
-				return ReadElementValue(Json::realValue, &Json::Value::asFloat, value);
+				return ReadElement(Json::realValue, [&](const JsonElement& element)
+				{
+					return JsonToken::NarrowReal(element.asDouble(), value) && PopElement();
+				});
 			}
 
 			virtual bool ReadDouble(double& value) override
@@ -55,6 +59,13 @@ namespace Reflecto
 				return ReadElementValue(Json::stringValue, &Json::Value::asString, value);
 			}
 
+			// Base64 text decoded into the bytes
+			virtual bool ReadBytes(std::string& bytes) override
+			{
+				std::string text;
+				return ReadString(text) && Base64Encoding::Decode(text, bytes);
+			}
+
 			virtual bool ReadBoolean(bool& value) override
 			{
 				return ReadElementValue(Json::booleanValue, &Json::Value::asBool, value);
@@ -170,24 +181,32 @@ namespace Reflecto
 			
 			using JsonProperties = Json::Value::Members;
 
-			template<typename member_function_ptr_type, typename type>
-			bool ReadElementValue(Json::ValueType valueType, member_function_ptr_type memberFunctionPtr, type& value)
-			{
-				std::function<type(const JsonElement&)> func = memberFunctionPtr;
-				return ReadElementValue(valueType, func, value);
-			}
-
-			template<typename type>
-			bool ReadElementValue(Json::ValueType valueType, const std::function<type(const JsonElement&)>& func, type& value)
+			template<typename func_t, typename type>
+			bool ReadElementValue(Json::ValueType valueType, const func_t& func, type& value)
 			{
 				return ReadElement(valueType, [&](const JsonElement& element)
 				{
 					bool success = false;
-					value = func(element);
+					value = std::invoke(func, element);
 					success = PopElement();
 					return success;
 				});
 			}
+
+			// Integers are typed intValue or uintValue by their magnitude in the document. Either
+			// is read as long as the value fits, never narrowed.
+			template<typename as_t, typename integer_t>
+			bool ReadIntegerValue(bool (Json::Value::*fits)() const, as_t as, integer_t& value)
+			{
+				bool success = false;
+				JsonElement* currentElement = nullptr;
+				if (GetCurrentElement(currentElement) && (currentElement->type() == Json::intValue || currentElement->type() == Json::uintValue) && (currentElement->*fits)())
+				{
+					value = static_cast<integer_t>(std::invoke(as, *currentElement));
+					success = PopElement();
+				}
+				return success;
+			}
 			
 			template<typename funct_t>
 			bool ReadElement(Json::ValueType valueType, const funct_t& func)
@@ -0,0 +1,487 @@
+#pragma once
+
+#include "Serialization/Base64Encoding.h"
+#include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/Reader/JsonToken.h"
+
+#include "Common/Definitions.h"
+#include "Utils/IOExt.h"
+
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Reads JSON by pulling tokens from a contiguous buffer as the read calls arrive, without
+		// building a document. Only a frame per open object or array is kept, so memory follows
+		// nesting depth rather than document size. Values are typed like JsonSerializationReader:
+		// integers and reals are told apart by their fraction or exponent. Properties are read in
+		// document order, and a property whose value is not read is skipped when it ends. Input is
+		// a caller owned buffer or a memory mapped file that strings and numbers are read in place from.
+		class JsonStreamSerializationReader : public ISerializationReader
+		{
+		public:
+			virtual bool ReadInteger32(int32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadUnsignedInteger32(uint32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadInteger64(int64_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadFloat(float& value) override
+			{
+				return ReadReal(value);
+			}
+
+			virtual bool ReadDouble(double& value) override
+			{
+				return ReadReal(value);
+			}
+
+			virtual bool ReadString(std::string& value) override
+			{
+				std::string_view view;
+				const bool success = ReadStringView(view);
+				if (success)
+				{
+					value.assign(view);
+				}
+				return success;
+			}
+
+			// Strings without escapes are views into the input, others are decoded into a buffer
+			// of the reader. Either way the view is valid until the next read.
+			bool ReadStringView(std::string_view& value)
+			{
+				bool success = false;
+				SkipWhitespace();
+				const size_t start = _position;
+				if (ParseString(value))
+				{
+					MarkValueRead();
+					success = true;
+				}
+				else
+				{
+					_position = start;
+				}
+				return success;
+			}
+
+			// Base64 text decoded into the bytes
+			virtual bool ReadBytes(std::string& bytes) override
+			{
+				std::string_view text;
+				return ReadStringView(text) && Base64Encoding::Decode(text, bytes);
+			}
+
+			virtual bool ReadBoolean(bool& value) override
+			{
+				bool success = false;
+				if (ReadLiteral("true"))
+				{
+					value = true;
+					success = true;
+				}
+				else if (ReadLiteral("false"))
+				{
+					value = false;
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadNull(void* value) override
+			{
+				return ReadLiteral("null");
+			}
+
+			virtual bool ReadBeginObject() override
+			{
+				return BeginFrame('{', FrameKind::Object);
+			}
+
+			virtual bool ReadEndObject() override
+			{
+				return EndFrame('}', FrameKind::Object);
+			}
+
+			virtual bool HasObjectPropertyRemaining() override
+			{
+				return HasRemaining('}', FrameKind::Object);
+			}
+
+			virtual bool ReadBeginObjectProperty(std::string& propertyName) override
+			{
+				std::string_view view;
+				const bool success = ReadBeginObjectProperty(view);
+				if (success)
+				{
+					propertyName.assign(view);
+				}
+				return success;
+			}
+
+			bool ReadBeginObjectProperty(std::string_view& propertyName)
+			{
+				bool success = false;
+				if (BeginEntry(FrameKind::Object) && ParseString(propertyName) && Expect(':'))
+				{
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadEndObjectProperty() override
+			{
+				return EndEntry(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginArray() override
+			{
+				return BeginFrame('[', FrameKind::Array);
+			}
+
+			virtual bool ReadEndArray() override
+			{
+				return EndFrame(']', FrameKind::Array);
+			}
+
+			virtual bool HasArrayElementRemaining() override
+			{
+				return HasRemaining(']', FrameKind::Array);
+			}
+
+			virtual bool ReadBeginArrayElement(uint32_t& index) override
+			{
+				bool success = false;
+				if (!_frames.empty())
+				{
+					index = _frames.back().count;
+					success = BeginEntry(FrameKind::Array);
+				}
+				return success;
+			}
+
+			virtual bool ReadEndArrayElement() override
+			{
+				return EndEntry(FrameKind::Array);
+			}
+
+			// Reads the whole stream into a buffer owned by the reader
+			bool Import(std::istream& inputStream)
+			{
+				_ownedInput.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+				return Import(std::string_view(_ownedInput));
+			}
+
+			// Maps the file in memory for as long as the reader reads it
+			bool ImportFile(const std::string& file)
+			{
+				return IOExt::MapFile(file, _mappedInput) && Import(_mappedInput.GetView());
+			}
+
+			// Reads from a buffer that must outlive the reads
+			bool Import(std::string_view input)
+			{
+				// Byte order mark is ignored
+				constexpr std::string_view kByteOrderMark = "\xEF\xBB\xBF";
+				if (input.substr(0, kByteOrderMark.size()) == kByteOrderMark)
+				{
+					input.remove_prefix(kByteOrderMark.size());
+				}
+
+				_input = input;
+				_position = 0;
+				_frames.clear();
+				_failed = false;
+				SkipWhitespace();
+				return _position < _input.size();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				bool pendingValue;
+				uint32_t count;
+			};
+
+			template<typename integer_t>
+			bool ReadInteger(integer_t& value)
+			{
+				bool success = false;
+				const std::string_view token = PeekNumber();
+				if (JsonToken::ParseInteger(token, value))
+				{
+					ConsumeValue(token.size());
+					success = true;
+				}
+				return success;
+			}
+
+			template<typename real_t>
+			bool ReadReal(real_t& value)
+			{
+				bool success = false;
+				const std::string_view token = PeekNumber();
+				if (JsonToken::ParseReal(token, value))
+				{
+					ConsumeValue(token.size());
+					success = true;
+				}
+				return success;
+			}
+
+			// Finds the number at the cursor without consuming it
+			std::string_view PeekNumber()
+			{
+				SkipWhitespace();
+				return JsonToken::FindNumber(_input.substr(_position));
+			}
+
+			bool ReadLiteral(std::string_view literal)
+			{
+				bool success = false;
+				SkipWhitespace();
+				if (_input.substr(_position, literal.size()) == literal)
+				{
+					ConsumeValue(literal.size());
+					success = true;
+				}
+				return success;
+			}
+
+			void ConsumeValue(size_t length)
+			{
+				_position += length;
+				MarkValueRead();
+			}
+
+			void MarkValueRead()
+			{
+				if (!_frames.empty())
+				{
+					_frames.back().pendingValue = false;
+				}
+			}
+
+			bool BeginFrame(char open, FrameKind kind)
+			{
+				bool success = false;
+				if (Expect(open))
+				{
+					MarkValueRead();
+					_frames.push_back(Frame{ kind, false, 0 });
+					success = true;
+				}
+				return success;
+			}
+
+			bool EndFrame(char close, FrameKind kind)
+			{
+				bool success = false;
+				if (!_failed && !_frames.empty() && _frames.back().kind == kind && Expect(close))
+				{
+					_frames.pop_back();
+					success = true;
+				}
+				return success;
+			}
+
+			// Anything but a separator or the closer after an entry is malformed, the failure is
+			// kept so that loops over the entries stop and the end of the container fails
+			bool HasRemaining(char close, FrameKind kind)
+			{
+				SkipWhitespace();
+				bool remaining = false;
+				if (!_failed && !_frames.empty() && _frames.back().kind == kind)
+				{
+					const char c = _position < _input.size() ? _input[_position] : '\0';
+					remaining = c != close && c != '\0';
+					_failed = _frames.back().count > 0 && c != close && c != ',';
+					remaining &= !_failed;
+				}
+				return remaining;
+			}
+
+			bool BeginEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					Frame& frame = _frames.back();
+					if (frame.count == 0 || Expect(','))
+					{
+						++frame.count;
+						frame.pendingValue = true;
+						success = true;
+					}
+				}
+				_failed |= !success;
+				return success;
+			}
+
+			bool EndEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					// Value of the entry was not read by the caller
+					success = !_frames.back().pendingValue || SkipValue();
+					_frames.back().pendingValue = false;
+				}
+				_failed |= !success;
+				return success;
+			}
+
+			bool SkipValue()
+			{
+				SkipWhitespace();
+				bool success = false;
+				if (_position < _input.size())
+				{
+					const char c = _input[_position];
+					if (c == '"')
+					{
+						success = SkipString();
+					}
+					else if (c == '{' || c == '[')
+					{
+						// Counts brackets only, strings are skipped so that their content is ignored
+						uint32_t depth = 0;
+						do
+						{
+							const char current = _input[_position];
+							if (current == '"')
+							{
+								if (!SkipString())
+								{
+									break;
+								}
+								continue;
+							}
+							depth += current == '{' || current == '[';
+							depth -= current == '}' || current == ']';
+							++_position;
+						} while (depth > 0 && _position < _input.size());
+						success = depth == 0;
+					}
+					else
+					{
+						const size_t start = _position;
+						while (_position < _input.size() && !IsDelimiter(_input[_position]))
+						{
+							++_position;
+						}
+						success = _position > start;
+					}
+				}
+				return success;
+			}
+
+			bool SkipString()
+			{
+				const size_t end = JsonToken::FindStringEnd(_input, _position + 1);
+				_position = end != std::string_view::npos ? end + 1 : _input.size();
+				return end != std::string_view::npos;
+			}
+
+			static bool IsDelimiter(char c)
+			{
+				return c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '/';
+			}
+
+			bool Expect(char c)
+			{
+				bool success = false;
+				SkipWhitespace();
+				if (_position < _input.size() && _input[_position] == c)
+				{
+					++_position;
+					success = true;
+				}
+				return success;
+			}
+
+			// Comments are allowed, as they are by JsonCpp's default reader
+			void SkipWhitespace()
+			{
+				while (_position < _input.size())
+				{
+					const char c = _input[_position];
+					if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+					{
+						++_position;
+					}
+					else if (c == '/' && _input.substr(_position, 2) == "//")
+					{
+						const size_t end = _input.find('\n', _position);
+						_position = end != std::string_view::npos ? end + 1 : _input.size();
+					}
+					else if (c == '/' && _input.substr(_position, 2) == "/*")
+					{
+						const size_t end = _input.find("*/", _position + 2);
+						_position = end != std::string_view::npos ? end + 2 : _input.size();
+					}
+					else
+					{
+						break;
+					}
+				}
+			}
+
+			bool ParseString(std::string_view& value)
+			{
+				bool success = false;
+				if (Expect('"'))
+				{
+					size_t end = _input.find_first_of("\"\\", _position);
+					if (end != std::string_view::npos && _input[end] == '"')
+					{
+						value = _input.substr(_position, end - _position);
+						success = true;
+					}
+					else
+					{
+						// Escaped strings are decoded
+						end = JsonToken::FindStringEnd(_input, _position);
+						_decoded.clear();
+						success = end != std::string_view::npos && JsonToken::Unescape(_input.substr(_position, end - _position), _decoded);
+						value = _decoded;
+					}
+					_position = success ? end + 1 : _position;
+				}
+				return success;
+			}
+
+			std::string _ownedInput;
+			IOExt::MappedFile _mappedInput;
+			std::string_view _input;
+			std::string _decoded;
+			size_t _position = 0;
+			std::vector<Frame> _frames;
+			bool _failed = false;
+		};
+	}
+}
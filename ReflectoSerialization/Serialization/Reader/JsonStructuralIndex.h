@@ -0,0 +1,265 @@
+#pragma once
+
+#include "Utils/CpuExt.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// First stage of JSON parsing: classifies the input 64 bytes at a time and records the
+		// position of every structural character outside strings, of every unescaped quote and
+		// of the first character of every number or literal. Classification uses AVX2 or SSE2
+		// when the processor has them and a scalar loop otherwise, all giving the same index.
+		// String state is carried from block to block with bit arithmetic rather than branches.
+		class JsonStructuralIndex
+		{
+		public:
+			enum class Implementation : uint8_t
+			{
+				Scalar,
+				Sse2,
+				Avx2
+			};
+
+			static bool IsSupported(Implementation implementation)
+			{
+				bool supported = implementation == Implementation::Scalar;
+#ifdef REFLECTO_X64
+				// SSE2 is part of x64
+				supported |= implementation == Implementation::Sse2;
+				supported |= implementation == Implementation::Avx2 && CpuExt::HasAvx2();
+#endif
+				return supported;
+			}
+
+			static Implementation GetBestImplementation()
+			{
+				static const Implementation best = IsSupported(Implementation::Avx2) ? Implementation::Avx2 : IsSupported(Implementation::Sse2) ? Implementation::Sse2 : Implementation::Scalar;
+				return best;
+			}
+
+			bool Build(std::string_view input)
+			{
+				return Build(input, GetBestImplementation());
+			}
+
+			// Fails when a string is left open or when the input is too large for 32 bit positions
+			bool Build(std::string_view input, Implementation implementation)
+			{
+				_count = 0;
+				_escapedCarry = 0;
+				_inStringCarry = 0;
+				_atomCarry = 0;
+
+				bool success = false;
+				if (IsSupported(implementation) && input.size() < std::numeric_limits<uint32_t>::max())
+				{
+					switch (implementation)
+					{
+#ifdef REFLECTO_X64
+					case Implementation::Avx2: IndexBlocks<&ClassifyAvx2>(input); break;
+					case Implementation::Sse2: IndexBlocks<&ClassifySse2>(input); break;
+#endif
+					default: IndexBlocks<&ClassifyScalar>(input); break;
+					}
+					success = _inStringCarry == 0;
+				}
+				_positions.resize(success ? _count : 0);
+				return success;
+			}
+
+			const std::vector<uint32_t>& GetPositions() const
+			{
+				return _positions;
+			}
+
+		private:
+			static constexpr size_t kBlockSize = 64;
+
+			struct BlockMasks
+			{
+				uint64_t quote;
+				uint64_t backslash;
+				uint64_t structural;
+				uint64_t whitespace;
+			};
+
+			using classify_func_t = BlockMasks(*)(const char* block);
+
+			template<classify_func_t classify>
+			void IndexBlocks(std::string_view input)
+			{
+				size_t offset = 0;
+				for (; offset + kBlockSize <= input.size(); offset += kBlockSize)
+				{
+					IndexBlock(classify(input.data() + offset), static_cast<uint32_t>(offset));
+				}
+
+				// Last partial block is padded with whitespace, which is never indexed
+				if (offset < input.size())
+				{
+					char block[kBlockSize];
+					std::memset(block, ' ', kBlockSize);
+					std::memcpy(block, input.data() + offset, input.size() - offset);
+					IndexBlock(classify(block), static_cast<uint32_t>(offset));
+				}
+			}
+
+			void IndexBlock(const BlockMasks& masks, uint32_t offset)
+			{
+				// Characters that follow an odd run of backslashes are escaped. Runs are found by
+				// subtracting each run's start from the run shifted onto odd bits.
+				constexpr uint64_t kOddBits = 0xAAAAAAAAAAAAAAAAull;
+				uint64_t escaped = _escapedCarry;
+				if (masks.backslash != 0)
+				{
+					const uint64_t escape = masks.backslash & ~_escapedCarry;
+					const uint64_t escapeAndTerminal = (((escape << 1) | kOddBits) - escape) ^ kOddBits;
+					escaped = escapeAndTerminal ^ (masks.backslash | _escapedCarry);
+					_escapedCarry = (escapeAndTerminal & masks.backslash) >> 63;
+				}
+				else
+				{
+					_escapedCarry = 0;
+				}
+
+				// Characters between an opening quote, included, and its closing quote, excluded
+				const uint64_t quote = masks.quote & ~escaped;
+				const uint64_t inString = PrefixXor(quote) ^ _inStringCarry;
+				_inStringCarry = uint64_t(0) - (inString >> 63);
+
+				// Numbers and literals are runs of any other character outside strings
+				const uint64_t atom = ~(masks.structural | masks.whitespace | masks.quote | inString);
+				const uint64_t atomStart = atom & ~((atom << 1) | _atomCarry);
+				_atomCarry = atom >> 63;
+
+				Flatten((masks.structural & ~inString) | quote | atomStart, offset);
+			}
+
+			void Flatten(uint64_t bits, uint32_t offset)
+			{
+				if (_count + kBlockSize > _positions.size())
+				{
+					_positions.resize(std::max(_positions.size() * 2, _count + kBlockSize));
+				}
+
+				uint32_t* positions = _positions.data() + _count;
+				while (bits != 0)
+				{
+					*positions++ = offset + TrailingZeroCount(bits);
+					bits &= bits - 1;
+				}
+				_count = positions - _positions.data();
+			}
+
+			static uint64_t PrefixXor(uint64_t bits)
+			{
+				bits ^= bits << 1;
+				bits ^= bits << 2;
+				bits ^= bits << 4;
+				bits ^= bits << 8;
+				bits ^= bits << 16;
+				bits ^= bits << 32;
+				return bits;
+			}
+
+			static uint32_t TrailingZeroCount(uint64_t bits)
+			{
+#ifdef _MSC_VER
+				unsigned long index;
+				if (!_BitScanForward(&index, static_cast<uint32_t>(bits)))
+				{
+					_BitScanForward(&index, static_cast<uint32_t>(bits >> 32));
+					index += 32;
+				}
+				return index;
+#else
+				return __builtin_ctzll(bits);
+#endif
+			}
+
+			static BlockMasks ClassifyScalar(const char* block)
+			{
+				BlockMasks masks = {};
+				for (size_t i = 0; i < kBlockSize; ++i)
+				{
+					const uint64_t bit = uint64_t(1) << i;
+					switch (block[i])
+					{
+					case '"': masks.quote |= bit; break;
+					case '\\': masks.backslash |= bit; break;
+					case '{': case '}': case '[': case ']': case ':': case ',': masks.structural |= bit; break;
+					case ' ': case '\t': case '\n': case '\r': masks.whitespace |= bit; break;
+					default: break;
+					}
+				}
+				return masks;
+			}
+
+#ifdef REFLECTO_X64
+			// '[' and ']' only differ from '{' and '}' by bit 0x20
+			static BlockMasks ClassifySse2(const char* block)
+			{
+				BlockMasks masks = {};
+				for (size_t i = 0; i < kBlockSize; i += 16)
+				{
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+					const __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+					const __m128i structural = _mm_or_si128(
+						_mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+						_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8(','))));
+					const __m128i whitespace = _mm_or_si128(
+						_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+						_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+
+					masks.quote |= Movemask(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"'))) << i;
+					masks.backslash |= Movemask(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))) << i;
+					masks.structural |= Movemask(structural) << i;
+					masks.whitespace |= Movemask(whitespace) << i;
+				}
+				return masks;
+			}
+
+			REFLECTO_TARGET_AVX2 static BlockMasks ClassifyAvx2(const char* block)
+			{
+				BlockMasks masks = {};
+				for (size_t i = 0; i < kBlockSize; i += 32)
+				{
+					const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+					const __m256i folded = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+					const __m256i structural = _mm256_or_si256(
+						_mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+						_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(','))));
+					const __m256i whitespace = _mm256_or_si256(
+						_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'))),
+						_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r'))));
+
+					masks.quote |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"'))))) << i;
+					masks.backslash |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\'))))) << i;
+					masks.structural |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(structural))) << i;
+					masks.whitespace |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(whitespace))) << i;
+				}
+				return masks;
+			}
+
+			static uint64_t Movemask(__m128i mask)
+			{
+				return static_cast<uint32_t>(_mm_movemask_epi8(mask));
+			}
+#endif
+
+			std::vector<uint32_t> _positions;
+			size_t _count = 0;
+			uint64_t _escapedCarry = 0;
+			uint64_t _inStringCarry = 0;
+			uint64_t _atomCarry = 0;
+		};
+	}
+}
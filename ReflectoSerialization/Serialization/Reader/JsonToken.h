@@ -0,0 +1,280 @@
+#pragma once
+
+#include "Serialization/BinaryEncoding.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Decoding of JSON scalar tokens, shared by the readers that parse in place
+		namespace JsonToken
+		{
+			// Number at the start of text, empty when text does not start with a number
+			inline std::string_view FindNumber(std::string_view text)
+			{
+				size_t end = 0;
+				while (end < text.size())
+				{
+					const char c = text[end];
+					if (!(c >= '0' && c <= '9') && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E')
+					{
+						break;
+					}
+					++end;
+				}
+				return text.substr(0, end);
+			}
+
+			// Numbers with a fraction or an exponent are reals. Integers too large for 64 bits
+			// are reals too, as they are for JsonCpp.
+			inline bool IsReal(std::string_view number)
+			{
+				bool real = number.find_first_of(".eE") != std::string_view::npos;
+				if (!real && !number.empty())
+				{
+					uint64_t magnitude = 0;
+					const char* digits = number.data() + (number[0] == '-' ? 1 : 0);
+					real = std::from_chars(digits, number.data() + number.size(), magnitude).ec == std::errc::result_out_of_range;
+				}
+				return real;
+			}
+
+			// Eight characters as a word, the first one in the lowest byte
+			inline uint64_t LoadEight(const char* text)
+			{
+				uint64_t chunk = 0;
+				std::memcpy(&chunk, text, sizeof(chunk));
+				if (!BinaryEncoding::IsLittleEndian())
+				{
+					uint64_t swapped = 0;
+					for (size_t i = 0; i < sizeof(chunk); ++i)
+					{
+						swapped = (swapped << 8) | ((chunk >> (8 * i)) & 0xFF);
+					}
+					chunk = swapped;
+				}
+				return chunk;
+			}
+
+			// Whether every byte is between '0' and '9': the high nibble must be 3 and adding 6
+			// to the low nibble must not carry into it
+			inline bool IsEightDigits(uint64_t chunk)
+			{
+				return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+			}
+
+			// Value of eight digits, combined in pairs, then quads, then as a whole with three
+			// multiplications rather than one per digit
+			inline uint32_t ParseEightDigits(uint64_t chunk)
+			{
+				chunk -= 0x3030303030303030;
+				chunk = (chunk * 10) + (chunk >> 8);
+				chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) + (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+				return static_cast<uint32_t>(chunk);
+			}
+
+			// Digits only, failing past the range of 64 bits
+			inline bool ParseMagnitude(const char* digits, const char* end, uint64_t& magnitude)
+			{
+				constexpr uint64_t kLimit = std::numeric_limits<uint64_t>::max() / 10;
+				constexpr uint64_t kLimitDigit = std::numeric_limits<uint64_t>::max() % 10;
+
+				// Sixteen digits cannot overflow
+				bool success = digits < end;
+				const char* position = digits;
+				magnitude = 0;
+				while (end - position >= 8 && position - digits < 16 && IsEightDigits(LoadEight(position)))
+				{
+					magnitude = magnitude * 100000000 + ParseEightDigits(LoadEight(position));
+					position += 8;
+				}
+
+				for (; position < end && success; ++position)
+				{
+					const uint64_t digit = static_cast<uint8_t>(*position - '0');
+					success = digit <= 9 && (magnitude < kLimit || (magnitude == kLimit && digit <= kLimitDigit));
+					magnitude = magnitude * 10 + digit;
+				}
+				return success;
+			}
+
+			// Numbers with a fraction or an exponent fail, as do values out of the range of
+			// integer_t, which are never narrowed
+			template<typename integer_t>
+			bool ParseInteger(std::string_view number, integer_t& value)
+			{
+				const bool negative = !number.empty() && number[0] == '-';
+				const char* digits = number.data() + (negative ? 1 : 0);
+				uint64_t magnitude = 0;
+				bool success = digits < number.data() + number.size() && ParseMagnitude(digits, number.data() + number.size(), magnitude);
+				if (success)
+				{
+					using unsigned_t = std::make_unsigned_t<integer_t>;
+					const uint64_t negativeLimit = std::is_signed_v<integer_t> ? uint64_t(unsigned_t(std::numeric_limits<integer_t>::max())) + 1 : 0;
+					success = magnitude <= (negative ? negativeLimit : uint64_t(std::numeric_limits<integer_t>::max()));
+					if (success)
+					{
+						value = static_cast<integer_t>(negative ? 0 - magnitude : magnitude);
+					}
+				}
+				return success;
+			}
+
+			inline bool ParseReal(std::string_view number, double& value)
+			{
+				bool success = false;
+				if (!number.empty() && IsReal(number))
+				{
+					const std::from_chars_result result = std::from_chars(number.data(), number.data() + number.size(), value);
+					success = result.ptr == number.data() + number.size();
+					if (success && result.ec == std::errc::result_out_of_range)
+					{
+						// Written for infinities, such as 1e+9999, and read back as such
+						const bool underflow = number.find("e-") != std::string_view::npos || number.find("E-") != std::string_view::npos;
+						value = underflow ? 0.0 : std::numeric_limits<double>::infinity();
+						value = number[0] == '-' ? -value : value;
+					}
+				}
+				return success;
+			}
+
+			// Reals beyond the range of floats fail rather than becoming infinities, infinities
+			// and NaN stay as they are
+			inline bool NarrowReal(double real, float& value)
+			{
+				// Halfway between the largest float and the next power of two, which rounds up
+				constexpr double kFloatOverflow = 0x1.ffffffp+127;
+				const bool success = !std::isfinite(real) || std::fabs(real) < kFloatOverflow;
+				if (success)
+				{
+					value = static_cast<float>(real);
+				}
+				return success;
+			}
+
+			inline bool ParseReal(std::string_view number, float& value)
+			{
+				double real = 0;
+				return ParseReal(number, real) && NarrowReal(real, value);
+			}
+
+			// Position of the quote closing the string whose content starts at start, or npos
+			inline size_t FindStringEnd(std::string_view text, size_t start)
+			{
+				size_t end = start;
+				while (end < text.size() && text[end] != '"')
+				{
+					end += text[end] == '\\' ? 2 : 1;
+				}
+				return end < text.size() ? end : std::string_view::npos;
+			}
+
+			inline void AppendUtf8(std::string& value, uint32_t codepoint)
+			{
+				if (codepoint < 0x80)
+				{
+					value += static_cast<char>(codepoint);
+				}
+				else if (codepoint < 0x800)
+				{
+					value += static_cast<char>(0xC0 | (codepoint >> 6));
+					value += static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+				else if (codepoint < 0x10000)
+				{
+					value += static_cast<char>(0xE0 | (codepoint >> 12));
+					value += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+					value += static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+				else
+				{
+					value += static_cast<char>(0xF0 | (codepoint >> 18));
+					value += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+					value += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+					value += static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+			}
+
+			inline bool ParseCodeUnit(std::string_view text, size_t& position, uint32_t& codeUnit)
+			{
+				bool success = false;
+				if (position + 4 <= text.size())
+				{
+					const char* begin = text.data() + position;
+					success = std::from_chars(begin, begin + 4, codeUnit, 16).ptr == begin + 4;
+					position += 4;
+				}
+				return success;
+			}
+
+			// Decodes the content of a string, quotes excluded, and appends it to value
+			inline bool Unescape(std::string_view content, std::string& value)
+			{
+				bool success = true;
+				size_t position = 0;
+				while (success && position < content.size())
+				{
+					// Unescaped runs are appended at once
+					const size_t escape = std::min(content.find('\\', position), content.size());
+					value.append(content.data() + position, escape - position);
+					position = escape;
+					if (position >= content.size())
+					{
+						break;
+					}
+
+					success = position + 1 < content.size();
+					if (success)
+					{
+						const char escaped = content[position + 1];
+						position += 2;
+						switch (escaped)
+						{
+						case '"': value += '"'; break;
+						case '\\': value += '\\'; break;
+						case '/': value += '/'; break;
+						case 'b': value += '\b'; break;
+						case 'f': value += '\f'; break;
+						case 'n': value += '\n'; break;
+						case 'r': value += '\r'; break;
+						case 't': value += '\t'; break;
+						case 'u':
+						{
+							uint32_t codepoint = 0;
+							success = ParseCodeUnit(content, position, codepoint);
+							if (success && codepoint >= 0xD800 && codepoint <= 0xDBFF)
+							{
+								// High surrogate must be followed by an escaped low surrogate
+								uint32_t low = 0;
+								success = content.substr(position, 2) == "\\u";
+								position += 2;
+								success = success && ParseCodeUnit(content, position, low) && low >= 0xDC00 && low <= 0xDFFF;
+								codepoint = 0x10000 + ((codepoint & 0x3FF) << 10) + (low & 0x3FF);
+							}
+							if (success)
+							{
+								AppendUtf8(value, codepoint);
+							}
+						}
+						break;
+						default:
+							success = false;
+							break;
+						}
+					}
+				}
+				return success;
+			}
+		}
+	}
+}
@@ -0,0 +1,508 @@
+#pragma once
+
+#include "Serialization/MsgPackEncoding.h"
+#include "Serialization/Reader/ISerializationReader.h"
+
+#include "Utils/IOExt.h"
+
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Reads MessagePack in place from a contiguous buffer. Integers are read from any integer
+		// encoding whose value fits the requested type, floats and doubles from either float
+		// encoding. Objects are maps keyed by str. A property whose value is not read is skipped
+		// when it ends, and a value that fails to read leaves the cursor where it was.
+		class MsgPackSerializationReader : public ISerializationReader
+		{
+		public:
+			virtual bool ReadInteger32(int32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadUnsignedInteger32(uint32_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadInteger64(int64_t& value) override
+			{
+				return ReadInteger(value);
+			}
+
+			virtual bool ReadFloat(float& value) override
+			{
+				double real = 0;
+				const bool success = ReadDouble(real);
+				if (success)
+				{
+					value = static_cast<float>(real);
+				}
+				return success;
+			}
+
+			virtual bool ReadDouble(double& value) override
+			{
+				bool success = false;
+				size_t position = _position;
+				const uint8_t type = PeekType();
+				if (type == MsgPackEncoding::kFloat32)
+				{
+					float real = 0;
+					success = MsgPackEncoding::ReadBigEndian(_input, ++position, real);
+					value = real;
+				}
+				else if (type == MsgPackEncoding::kFloat64)
+				{
+					success = MsgPackEncoding::ReadBigEndian(_input, ++position, value);
+				}
+				return success && ConsumeValue(position);
+			}
+
+			virtual bool ReadString(std::string& value) override
+			{
+				std::string_view view;
+				const bool success = ReadStringView(view);
+				if (success)
+				{
+					value.assign(view);
+				}
+				return success;
+			}
+
+			// View into the input, valid for as long as the input is
+			bool ReadStringView(std::string_view& value)
+			{
+				size_t position = _position;
+				return ParseString(position, value) && ConsumeValue(position);
+			}
+
+			virtual bool ReadBytes(std::string& bytes) override
+			{
+				std::string_view view;
+				const bool success = ReadBytesView(view);
+				if (success)
+				{
+					bytes.assign(view);
+				}
+				return success;
+			}
+
+			// Bytes written as bin, viewed in the input
+			bool ReadBytesView(std::string_view& value)
+			{
+				bool success = false;
+				size_t position = _position;
+				size_t size = 0;
+				switch (PeekType())
+				{
+				case MsgPackEncoding::kBin8: success = ReadSize<uint8_t>(++position, size); break;
+				case MsgPackEncoding::kBin16: success = ReadSize<uint16_t>(++position, size); break;
+				case MsgPackEncoding::kBin32: success = ReadSize<uint32_t>(++position, size); break;
+				default: break;
+				}
+				if (success)
+				{
+					value = _input.substr(position, size);
+					position += size;
+				}
+				return success && ConsumeValue(position);
+			}
+
+			virtual bool ReadBoolean(bool& value) override
+			{
+				const uint8_t type = PeekType();
+				const bool success = (type == MsgPackEncoding::kTrue || type == MsgPackEncoding::kFalse) && ConsumeValue(_position + 1);
+				value = type == MsgPackEncoding::kTrue;
+				return success;
+			}
+
+			virtual bool ReadNull(void* value) override
+			{
+				return _position < _input.size() && PeekType() == MsgPackEncoding::kNil && ConsumeValue(_position + 1);
+			}
+
+			virtual bool ReadBeginObject() override
+			{
+				return BeginFrame(FrameKind::Object);
+			}
+
+			virtual bool ReadEndObject() override
+			{
+				return EndFrame(FrameKind::Object);
+			}
+
+			virtual bool HasObjectPropertyRemaining() override
+			{
+				return HasRemaining(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginObjectProperty(std::string& propertyName) override
+			{
+				std::string_view view;
+				const bool success = ReadBeginObjectProperty(view);
+				if (success)
+				{
+					propertyName.assign(view);
+				}
+				return success;
+			}
+
+			bool ReadBeginObjectProperty(std::string_view& propertyName)
+			{
+				bool success = false;
+				size_t position = _position;
+				if (HasRemaining(FrameKind::Object) && ParseString(position, propertyName))
+				{
+					_position = position;
+					BeginEntry();
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadEndObjectProperty() override
+			{
+				return EndEntry(FrameKind::Object);
+			}
+
+			virtual bool ReadBeginArray() override
+			{
+				return BeginFrame(FrameKind::Array);
+			}
+
+			virtual bool ReadEndArray() override
+			{
+				return EndFrame(FrameKind::Array);
+			}
+
+			virtual bool HasArrayElementRemaining() override
+			{
+				return HasRemaining(FrameKind::Array);
+			}
+
+			virtual bool ReadBeginArrayElement(uint32_t& index) override
+			{
+				bool success = false;
+				if (HasRemaining(FrameKind::Array))
+				{
+					index = _frames.back().read;
+					BeginEntry();
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool ReadEndArrayElement() override
+			{
+				return EndEntry(FrameKind::Array);
+			}
+
+			// Reads the whole stream into a buffer owned by the reader
+			bool Import(std::istream& inputStream)
+			{
+				_ownedInput.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+				return Import(std::string_view(_ownedInput));
+			}
+
+			// Maps the file in memory for as long as the reader reads it
+			bool ImportFile(const std::string& file)
+			{
+				return IOExt::MapFile(file, _mappedInput) && Import(_mappedInput.GetView());
+			}
+
+			// Reads from a buffer that must outlive the reads
+			bool Import(std::string_view input)
+			{
+				_input = input;
+				_position = 0;
+				_frames.clear();
+				return !_input.empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				bool pendingValue;
+				uint32_t count;
+				uint32_t read;
+			};
+
+			template<typename integer_t>
+			bool ReadInteger(integer_t& value)
+			{
+				bool success = false;
+				size_t position = _position;
+				const uint8_t type = PeekType();
+				if (position < _input.size() && (type <= MsgPackEncoding::kPositiveFixIntMax || type >= MsgPackEncoding::kNegativeFixIntMin))
+				{
+					success = FitInteger(static_cast<int8_t>(type), value);
+					++position;
+				}
+				else
+				{
+					switch (type)
+					{
+					case MsgPackEncoding::kUInt8: success = ReadEncodedInteger<uint8_t>(++position, value); break;
+					case MsgPackEncoding::kUInt16: success = ReadEncodedInteger<uint16_t>(++position, value); break;
+					case MsgPackEncoding::kUInt32: success = ReadEncodedInteger<uint32_t>(++position, value); break;
+					case MsgPackEncoding::kUInt64: success = ReadEncodedInteger<uint64_t>(++position, value); break;
+					case MsgPackEncoding::kInt8: success = ReadEncodedInteger<int8_t>(++position, value); break;
+					case MsgPackEncoding::kInt16: success = ReadEncodedInteger<int16_t>(++position, value); break;
+					case MsgPackEncoding::kInt32: success = ReadEncodedInteger<int32_t>(++position, value); break;
+					case MsgPackEncoding::kInt64: success = ReadEncodedInteger<int64_t>(++position, value); break;
+					default: break;
+					}
+				}
+				return success && ConsumeValue(position);
+			}
+
+			template<typename encoded_t, typename integer_t>
+			bool ReadEncodedInteger(size_t& position, integer_t& value)
+			{
+				encoded_t encoded = 0;
+				return MsgPackEncoding::ReadBigEndian(_input, position, encoded) && FitInteger(encoded, value);
+			}
+
+			// Converts when the value is in the range of the requested type
+			template<typename encoded_t, typename integer_t>
+			static bool FitInteger(encoded_t encoded, integer_t& value)
+			{
+				bool fits = false;
+				if constexpr (std::is_signed_v<encoded_t>)
+				{
+					fits = encoded >= 0 ? static_cast<uint64_t>(encoded) <= static_cast<uint64_t>(std::numeric_limits<integer_t>::max())
+						: std::is_signed_v<integer_t> && static_cast<int64_t>(encoded) >= static_cast<int64_t>(std::numeric_limits<integer_t>::min());
+				}
+				else
+				{
+					fits = static_cast<uint64_t>(encoded) <= static_cast<uint64_t>(std::numeric_limits<integer_t>::max());
+				}
+				if (fits)
+				{
+					value = static_cast<integer_t>(encoded);
+				}
+				return fits;
+			}
+
+			template<typename size_t_>
+			bool ReadSize(size_t& position, size_t& size)
+			{
+				size_t_ encoded = 0;
+				const bool success = MsgPackEncoding::ReadBigEndian(_input, position, encoded) && encoded <= _input.size() - position;
+				size = encoded;
+				return success;
+			}
+
+			bool ParseString(size_t& position, std::string_view& value)
+			{
+				bool success = false;
+				size_t size = 0;
+				const uint8_t type = PeekType(position);
+				if (position < _input.size() && (type & 0xE0) == MsgPackEncoding::kFixStr)
+				{
+					size = type & MsgPackEncoding::kFixStrMaxSize;
+					success = size <= _input.size() - ++position;
+				}
+				else
+				{
+					switch (type)
+					{
+					case MsgPackEncoding::kStr8: success = ReadSize<uint8_t>(++position, size); break;
+					case MsgPackEncoding::kStr16: success = ReadSize<uint16_t>(++position, size); break;
+					case MsgPackEncoding::kStr32: success = ReadSize<uint32_t>(++position, size); break;
+					default: break;
+					}
+				}
+				if (success)
+				{
+					value = _input.substr(position, size);
+					position += size;
+				}
+				return success;
+			}
+
+			// Reads the header of a map or an array and the count of entries it announces
+			bool ParseContainer(size_t& position, FrameKind& kind, uint32_t& count)
+			{
+				bool success = false;
+				const uint8_t type = PeekType(position);
+				if (position < _input.size() && (type & 0xF0) == MsgPackEncoding::kFixMap)
+				{
+					kind = FrameKind::Object;
+					count = type & MsgPackEncoding::kFixContainerMaxSize;
+					success = true;
+					++position;
+				}
+				else if (position < _input.size() && (type & 0xF0) == MsgPackEncoding::kFixArray)
+				{
+					kind = FrameKind::Array;
+					count = type & MsgPackEncoding::kFixContainerMaxSize;
+					success = true;
+					++position;
+				}
+				else
+				{
+					uint16_t count16 = 0;
+					switch (type)
+					{
+					case MsgPackEncoding::kMap16: kind = FrameKind::Object; success = MsgPackEncoding::ReadBigEndian(_input, ++position, count16); count = count16; break;
+					case MsgPackEncoding::kMap32: kind = FrameKind::Object; success = MsgPackEncoding::ReadBigEndian(_input, ++position, count); break;
+					case MsgPackEncoding::kArray16: kind = FrameKind::Array; success = MsgPackEncoding::ReadBigEndian(_input, ++position, count16); count = count16; break;
+					case MsgPackEncoding::kArray32: kind = FrameKind::Array; success = MsgPackEncoding::ReadBigEndian(_input, ++position, count); break;
+					default: break;
+					}
+				}
+				return success;
+			}
+
+			// Type byte at the cursor, or nil past the end
+			uint8_t PeekType() const
+			{
+				return PeekType(_position);
+			}
+
+			uint8_t PeekType(size_t position) const
+			{
+				return position < _input.size() ? static_cast<uint8_t>(_input[position]) : MsgPackEncoding::kNil;
+			}
+
+			bool ConsumeValue(size_t position)
+			{
+				_position = position;
+				if (!_frames.empty())
+				{
+					_frames.back().pendingValue = false;
+				}
+				return true;
+			}
+
+			bool BeginFrame(FrameKind kind)
+			{
+				bool success = false;
+				size_t position = _position;
+				FrameKind actualKind;
+				uint32_t count = 0;
+				if (ParseContainer(position, actualKind, count) && actualKind == kind)
+				{
+					ConsumeValue(position);
+					_frames.push_back(Frame{ kind, false, count, 0 });
+					success = true;
+				}
+				return success;
+			}
+
+			bool EndFrame(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind && _frames.back().read == _frames.back().count)
+				{
+					_frames.pop_back();
+					success = true;
+				}
+				return success;
+			}
+
+			bool HasRemaining(FrameKind kind) const
+			{
+				return !_frames.empty() && _frames.back().kind == kind && _frames.back().read < _frames.back().count;
+			}
+
+			void BeginEntry()
+			{
+				++_frames.back().read;
+				_frames.back().pendingValue = true;
+			}
+
+			bool EndEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					// Value of the entry was not read by the caller
+					success = !_frames.back().pendingValue || SkipValue();
+					_frames.back().pendingValue = false;
+				}
+				return success;
+			}
+
+			// Skips a value and everything nested in it by counting the values left to skip
+			bool SkipValue()
+			{
+				bool success = true;
+				uint64_t remaining = 1;
+				while (success && remaining > 0)
+				{
+					--remaining;
+					success = _position < _input.size();
+					if (!success)
+					{
+						break;
+					}
+
+					const uint8_t type = PeekType();
+					size_t position = _position;
+					std::string_view bytes;
+					FrameKind kind;
+					uint32_t count = 0;
+					if (type <= MsgPackEncoding::kPositiveFixIntMax || type >= MsgPackEncoding::kNegativeFixIntMin || type == MsgPackEncoding::kNil || type == MsgPackEncoding::kFalse || type == MsgPackEncoding::kTrue)
+					{
+						++position;
+					}
+					else if (ParseContainer(position, kind, count))
+					{
+						remaining += kind == FrameKind::Object ? 2 * uint64_t(count) : count;
+					}
+					else if (!ParseString(position, bytes))
+					{
+						success = SkipFixedValue(type, position);
+					}
+					_position = position;
+				}
+				return success;
+			}
+
+			bool SkipFixedValue(uint8_t type, size_t& position)
+			{
+				bool success = true;
+				size_t size = 0;
+				++position;
+				switch (type)
+				{
+				case MsgPackEncoding::kUInt8: case MsgPackEncoding::kInt8: size = 1; break;
+				case MsgPackEncoding::kUInt16: case MsgPackEncoding::kInt16: size = 2; break;
+				case MsgPackEncoding::kUInt32: case MsgPackEncoding::kInt32: case MsgPackEncoding::kFloat32: size = 4; break;
+				case MsgPackEncoding::kUInt64: case MsgPackEncoding::kInt64: case MsgPackEncoding::kFloat64: size = 8; break;
+				case MsgPackEncoding::kBin8: success = ReadSize<uint8_t>(position, size); break;
+				case MsgPackEncoding::kBin16: success = ReadSize<uint16_t>(position, size); break;
+				case MsgPackEncoding::kBin32: success = ReadSize<uint32_t>(position, size); break;
+				default: success = false; break;
+				}
+				position += size;
+				return success && position <= _input.size();
+			}
+
+			std::string _ownedInput;
+			IOExt::MappedFile _mappedInput;
+			std::string_view _input;
+			size_t _position = 0;
+			std::vector<Frame> _frames;
+		};
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		enum class SerializationFormat
+		{
+			Short,
+			Descriptive
+		};
+	}
+}
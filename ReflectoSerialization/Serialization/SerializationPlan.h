@@ -0,0 +1,283 @@
+#pragma once
+
+#include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/SerializationFormat.h"
+#include "Serialization/StrategyKind.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+
+#include "Common/Definitions.h"
+#include "Common/Ensure.h"
+#include "Type/TypeDescriptor.h"
+#include "Type/TypeLibrary.h"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		struct PlanInstruction
+		{
+			StrategyKind kind;
+			uint32_t offset;
+			uint32_t plan;
+			const Reflection::TypeDescriptor* type;
+			const std::string* name;
+			// Reaches members without a fixed offset
+			const Reflection::MemberDescriptor* member;
+		};
+
+		struct SerializationPlan
+		{
+			const Reflection::TypeDescriptor* type;
+			std::vector<PlanInstruction> instructions;
+		};
+
+		// Plans of every object type of a library for one format. Each plan is a flat list of
+		// instructions, one per member, compiled once from the library layout so that serializing
+		// an object no longer looks up a strategy per member. Members whose strategy is primitive
+		// are read and written in place, objects recurse into their own plan and anything else
+		// goes through the serializer. Plans borrow descriptors and member names from the library,
+		// which must outlive them.
+		class SerializationPlans
+		{
+		public:
+			static constexpr uint32_t kNoPlan = std::numeric_limits<uint32_t>::max();
+			SerializationPlans() = default;
+
+			// Kinds of the strategies learned for each type, by position in the library
+			SerializationPlans(const Reflection::TypeLibrary& library, const std::vector<StrategyKind>& kinds, SerializationFormat format)
+				: _descriptive(format == SerializationFormat::Descriptive)
+			{
+				// Plans are numbered first so that members can refer to plans not compiled yet
+				const std::vector<Reflection::TypeDescriptorPtr>& descriptors = library.GetDescriptors();
+				_planByType.assign(descriptors.size(), kNoPlan);
+				for (uint32_t typeIndex = 0; typeIndex < descriptors.size(); ++typeIndex)
+				{
+					if (GetKind(kinds, typeIndex) == StrategyKind::Object)
+					{
+						_planByType[typeIndex] = static_cast<uint32_t>(_plans.size());
+						_plans.push_back(SerializationPlan{ descriptors[typeIndex].get(), {} });
+					}
+				}
+
+				const Reflection::TypeLibraryLayout& layout = library.GetLayout();
+				for (uint32_t typeIndex = 0; typeIndex < descriptors.size(); ++typeIndex)
+				{
+					if (_planByType[typeIndex] != kNoPlan)
+					{
+						SerializationPlan& plan = _plans[_planByType[typeIndex]];
+						for (const Reflection::MemberLayout& member : layout.GetMembers(typeIndex))
+						{
+							const Reflection::TypeDescriptor* memberType = library.FindDescriptorAt(member.typeIndex);
+							const StrategyKind kind = GetKind(kinds, member.typeIndex);
+							const uint32_t memberPlan = kind == StrategyKind::Object ? _planByType[member.typeIndex] : kNoPlan;
+							const Reflection::MemberDescriptor& memberDescriptor = layout.GetMemberDescriptor(member);
+							plan.instructions.push_back(PlanInstruction{ kind, member.offset, memberPlan, memberType, &memberDescriptor.GetName(), &memberDescriptor });
+						}
+					}
+				}
+			}
+
+			uint32_t FindPlan(uint32_t typeIndex) const
+			{
+				return typeIndex < _planByType.size() ? _planByType[typeIndex] : kNoPlan;
+			}
+
+			const SerializationPlan& GetPlan(uint32_t plan) const
+			{
+				return _plans[plan];
+			}
+
+			template<typename serializer_t>
+			bool Serialize(const serializer_t& serializer, uint32_t plan, const void* value, ISerializationWriter& writer) const
+			{
+				bool success = true;
+				const byte* object = static_cast<const byte*>(value);
+				success &= writer.WriteBeginObject();
+				{
+					for (const PlanInstruction& instruction : _plans[plan].instructions)
+					{
+						success &= writer.WriteBeginObjectProperty(*instruction.name);
+						{
+							const void* member = instruction.offset != Reflection::kNoOffset ? object + instruction.offset : instruction.member->ResolveMember(value);
+							if (_descriptive && instruction.kind != StrategyKind::Strategy)
+							{
+								success &= WriteDescriptive(serializer, instruction, member, writer);
+							}
+							else
+							{
+								success &= Write(serializer, instruction, member, writer);
+							}
+						}
+						success &= writer.WriteEndObjectProperty();
+					}
+				}
+				success &= writer.WriteEndObject();
+				return success;
+			}
+
+			template<typename serializer_t>
+			bool Deserialize(const serializer_t& serializer, uint32_t plan, void* value, ISerializationReader& reader) const
+			{
+				bool success = true;
+				byte* object = static_cast<byte*>(value);
+				const SerializationPlan& objectPlan = _plans[plan];
+				success &= reader.ReadBeginObject();
+				{
+					size_t next = 0;
+					std::string propertyName;
+					while (reader.HasObjectPropertyRemaining())
+					{
+						success &= reader.ReadBeginObjectProperty(propertyName);
+						{
+							const PlanInstruction* instruction = FindInstruction(objectPlan, propertyName, next);
+							if (instruction)
+							{
+								void* member = instruction->offset != Reflection::kNoOffset ? object + instruction->offset : instruction->member->ResolveMember(value);
+								if (_descriptive && instruction->kind != StrategyKind::Strategy)
+								{
+									success &= ReadDescriptive(serializer, *instruction, member, reader);
+								}
+								else
+								{
+									success &= Read(serializer, *instruction, member, reader);
+								}
+							}
+							else
+							{
+								// Inherited members are not part of the plan
+								const Reflection::MemberDescriptor* memberDescriptor = objectPlan.type->GetMemberByNameRecursive(propertyName);
+								if (ensure(memberDescriptor))
+								{
+									success &= serializer.Deserialize(memberDescriptor->GetType(), memberDescriptor->ResolveMember(value), reader);
+								}
+							}
+						}
+						success &= reader.ReadEndObjectProperty();
+					}
+				}
+				success &= reader.ReadEndObject();
+				return success;
+			}
+
+		private:
+			static StrategyKind GetKind(const std::vector<StrategyKind>& kinds, uint32_t typeIndex)
+			{
+				return typeIndex < kinds.size() ? kinds[typeIndex] : StrategyKind::Strategy;
+			}
+
+			// Properties are expected in the order they were written, and searched for otherwise
+			static const PlanInstruction* FindInstruction(const SerializationPlan& plan, const std::string& name, size_t& next)
+			{
+				const PlanInstruction* found = nullptr;
+				if (next < plan.instructions.size() && *plan.instructions[next].name == name)
+				{
+					found = &plan.instructions[next++];
+				}
+				else
+				{
+					for (size_t i = 0; i < plan.instructions.size() && !found; ++i)
+					{
+						if (*plan.instructions[i].name == name)
+						{
+							found = &plan.instructions[i];
+							next = i + 1;
+						}
+					}
+				}
+				return found;
+			}
+
+			template<typename serializer_t>
+			bool Write(const serializer_t& serializer, const PlanInstruction& instruction, const void* value, ISerializationWriter& writer) const
+			{
+				bool success = false;
+				switch (instruction.kind)
+				{
+				case StrategyKind::Object: success = Serialize(serializer, instruction.plan, value, writer); break;
+				case StrategyKind::Strategy: success = serializer.Serialize(instruction.type, value, writer); break;
+				default: success = StrategyKindExt::WritePrimitive(instruction.kind, value, writer); break;
+				}
+				return success;
+			}
+
+			template<typename serializer_t>
+			bool Read(const serializer_t& serializer, const PlanInstruction& instruction, void* value, ISerializationReader& reader) const
+			{
+				bool success = false;
+				switch (instruction.kind)
+				{
+				case StrategyKind::Object: success = Deserialize(serializer, instruction.plan, value, reader); break;
+				case StrategyKind::Strategy: success = serializer.Deserialize(instruction.type, value, reader); break;
+				default: success = StrategyKindExt::ReadPrimitive(instruction.kind, value, reader); break;
+				}
+				return success;
+			}
+
+			// Same wrapping as the serializer gives values in the descriptive format, which strategies
+			// get from the serializer itself
+			template<typename serializer_t>
+			bool WriteDescriptive(const serializer_t& serializer, const PlanInstruction& instruction, const void* value, ISerializationWriter& writer) const
+			{
+				bool success = true;
+				success &= writer.WriteBeginObject();
+				{
+					success &= writer.WriteBeginObjectProperty(kTypeProperty);
+					{
+						success &= writer.WriteString(instruction.type->GetName());
+					}
+					success &= writer.WriteEndObjectProperty();
+
+					success &= writer.WriteBeginObjectProperty(kValueProperty);
+					{
+						success &= Write(serializer, instruction, value, writer);
+					}
+					success &= writer.WriteEndObjectProperty();
+				}
+				success &= writer.WriteEndObject();
+				return success;
+			}
+
+			template<typename serializer_t>
+			bool ReadDescriptive(const serializer_t& serializer, const PlanInstruction& instruction, void* value, ISerializationReader& reader) const
+			{
+				bool success = true;
+				success &= reader.ReadBeginObject();
+				{
+					std::string property;
+					while (reader.HasObjectPropertyRemaining())
+					{
+						success &= reader.ReadBeginObjectProperty(property);
+						{
+							if (property == kTypeProperty)
+							{
+								std::string actualType;
+								success &= reader.ReadString(actualType);
+								assert(instruction.type->GetName() == actualType);
+							}
+							else if (property == kValueProperty)
+							{
+								success &= Read(serializer, instruction, value, reader);
+							}
+						}
+						success &= reader.ReadEndObjectProperty();
+					}
+				}
+				success &= reader.ReadEndObject();
+				return success;
+			}
+
+			inline static const std::string kTypeProperty = "type";
+			inline static const std::string kValueProperty = "value";
+
+			std::vector<SerializationPlan> _plans;
+			std::vector<uint32_t> _planByType;
+			bool _descriptive = false;
+		};
+	}
+}
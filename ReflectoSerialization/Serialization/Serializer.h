@@ -1,28 +1,32 @@
 #pragma once
 
 #include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/SerializationFormat.h"
+#include "Serialization/SerializationPlan.h"
+#include "Serialization/StrategyKind.h"
 #include "Serialization/Writer/ISerializationWriter.h"
 
 #include "Common/Definitions.h"
 #include "Common/Ensure.h"
+#include "Type/ReflectedValue.h"
 #include "Type/TypeDescriptor.h"
 #include "Type/TypeLibrary.h"
 
+#include <any>
+#include <array>
 #include <cassert>
-#include <map>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Reflecto
 {
 	namespace Serialization
 	{
-		enum class SerializationFormat
-		{
-			Short,
-			Descriptive
-		};
-
 		class Serializer
 		{
 		public:				
@@ -30,17 +34,54 @@ namespace Reflecto
 			using deserialization_strategy_t = typename std::function<bool(const Serializer&, void*, ISerializationReader& reader)>;
 			using any_cast_raw_strategy_t = typename std::function<void*(std::any&)>;
 			using strategies_t = std::tuple<serialization_strategy_t, deserialization_strategy_t, any_cast_raw_strategy_t>;
-			using strategy_map_t = std::map<Reflection::TypeDescriptorPtr, strategies_t>;
 
-			Serializer(const Reflection::TypeLibrary& library, const strategy_map_t& strategy)
-				: Serializer(library, strategy, SerializationFormat::Descriptive)
+			// A learned strategy, as plain functions called with the context they were learned with.
+			// Primitive and object kinds never call their functions, the serializer writes them itself.
+			struct Strategy
+			{
+				using serialize_function_t = bool(*)(const void* context, const Serializer&, const void*, ISerializationWriter&);
+				using deserialize_function_t = bool(*)(const void* context, const Serializer&, void*, ISerializationReader&);
+				using any_cast_function_t = void*(*)(const void* context, std::any&);
+
+				const Reflection::TypeDescriptor* type = nullptr;
+				StrategyKind kind = StrategyKind::Strategy;
+				const void* context = nullptr;
+				serialize_function_t serialize = nullptr;
+				deserialize_function_t deserialize = nullptr;
+				any_cast_function_t anyCast = nullptr;
+			};
+
+			// Strategies by position of their type in the library, unlearned types left empty.
+			// Contexts are kept alive by whoever built the table, usually with the library.
+			using strategy_table_t = std::vector<Strategy>;
+			using strategy_owners_t = std::vector<std::shared_ptr<const void>>;
+
+			Serializer(const Reflection::TypeLibrary& library, const strategy_table_t& strategies, const strategy_owners_t& owners = {})
+				: Serializer(library, strategies, owners, SerializationFormat::Descriptive)
 			{ }
 
-			Serializer(const Reflection::TypeLibrary& library, const strategy_map_t& strategy, SerializationFormat serializationFormat)
+			// Object types whose strategy is of the object kind are serialized by their plan, compiled
+			// here for every format
+			Serializer(const Reflection::TypeLibrary& library, const strategy_table_t& strategies, const strategy_owners_t& owners, SerializationFormat serializationFormat)
 				: _typeLibrary(library)
-				, _strategies(strategy)
+				, _strategies(strategies)
+				, _owners(owners)
 				, _serializationFormat(serializationFormat)
-			{ }
+			{
+				_strategies.resize(_typeLibrary.GetDescriptors().size());
+				std::vector<StrategyKind> kinds;
+				kinds.reserve(_strategies.size());
+				for (const Strategy& strategy : _strategies)
+				{
+					kinds.push_back(strategy.kind);
+				}
+				_plans = { SerializationPlans(_typeLibrary, kinds, SerializationFormat::Short), SerializationPlans(_typeLibrary, kinds, SerializationFormat::Descriptive) };
+			}
+
+			const Reflection::TypeLibrary& GetTypeLibrary() const
+			{
+				return _typeLibrary;
+			}
 
 			void SetSerializationFormat(SerializationFormat serializationFormat)
 			{
@@ -49,34 +90,33 @@ namespace Reflecto
 
 			bool Serialize(const Reflection::TypeDescriptorPtr& type, const void* value, ISerializationWriter& writer) const
 			{
-				bool success = false;
-				const serialization_strategy_t* strategy = GetSerializationStrategy(type);
-				if (strategy)
-				{
-					success = Serialize(type, *strategy, value, writer);
-				}
-				return success;
+				return Serialize(type.get(), value, writer);
+			}
+
+			bool Serialize(const Reflection::TypeDescriptor* type, const void* value, ISerializationWriter& writer) const
+			{
+				return Serialize(GetTypeIndex(type), value, writer);
 			}
 
 			template<typename value_t>
 			bool Serialize(const value_t& value, ISerializationWriter& writer) const
 			{
-				bool success = false;
-				Reflection::TypeDescriptorPtr type = _typeLibrary.GetDescriptor<value_t>();
-				if (type)
-				{
-					success = Serialize(type, &value, writer);
-				}
-				return success;
+				return Serialize(_typeLibrary.GetTypeIndex<value_t>(), &value, writer);
 			}
 
 			bool RawSerialize(const Reflection::TypeDescriptorPtr& type, const void* value, ISerializationWriter& writer) const
+			{
+				return RawSerialize(type.get(), value, writer);
+			}
+
+			bool RawSerialize(const Reflection::TypeDescriptor* type, const void* value, ISerializationWriter& writer) const
 			{
 				bool success = false;
-				const serialization_strategy_t* strategy = GetSerializationStrategy(type);
+				const uint32_t typeIndex = GetTypeIndex(type);
+				const Strategy* strategy = FindStrategy(typeIndex);
 				if (strategy)
 				{
-					success = RawSerialize(type, *strategy, value, writer);
+					success = RawSerialize(*strategy, typeIndex, value, writer);
 				}
 				return success;
 			}
@@ -85,27 +125,96 @@ namespace Reflecto
 			bool RawSerialize(const value_t& value, ISerializationWriter& writer) const
 			{
 				bool success = false;
-				Reflection::TypeDescriptorPtr type = _typeLibrary.GetDescriptor<value_t>();
-				success = RawSerialize(type, &value, writer);
+				const uint32_t typeIndex = _typeLibrary.GetTypeIndex<value_t>();
+				const Strategy* strategy = FindStrategy(typeIndex);
+				if (strategy)
+				{
+					success = RawSerialize(*strategy, typeIndex, &value, writer);
+				}
 				return success;
 			}
 
 			template<typename value_t>
 			bool Deserialize(value_t& value, ISerializationReader& reader) const
+			{
+				return Deserialize(_typeLibrary.GetTypeIndex<value_t>(), &value, reader);
+			}
+
+			bool Deserialize(const Reflection::TypeDescriptorPtr& type, void* value, ISerializationReader& reader) const
+			{
+				return Deserialize(type.get(), value, reader);
+			}
+
+			bool Deserialize(const Reflection::TypeDescriptor* type, void* value, ISerializationReader& reader) const
+			{
+				return Deserialize(GetTypeIndex(type), value, reader);
+			}
+
+			// Serializes contiguous elements as an array, resolving their strategy once for all of them.
+			// Numbers with their built-in strategy are written at once in the short format.
+			template<typename element_t>
+			bool SerializeRange(const element_t* elements, size_t count, ISerializationWriter& writer) const
 			{
 				bool success = false;
-				Reflection::TypeDescriptorPtr type = _typeLibrary.GetDescriptor<value_t>();
-				success = Deserialize(type, &value, reader);
+				const uint32_t typeIndex = _typeLibrary.GetTypeIndex<element_t>();
+				const Strategy* strategy = FindStrategy(typeIndex);
+				if (strategy)
+				{
+					if (IsNumberArray<element_t>(*strategy))
+					{
+						success = WriteNumberArray(elements, count, writer);
+					}
+					else
+					{
+						success = true;
+						success &= writer.WriteBeginArray();
+						{
+							for (size_t i = 0; i < count; ++i)
+							{
+								success &= writer.WriteBeginArrayElement();
+								{
+									success &= Serialize(*strategy, typeIndex, &elements[i], writer);
+								}
+								success &= writer.WriteEndArrayElement();
+							}
+						}
+						success &= writer.WriteEndArray();
+					}
+				}
 				return success;
 			}
 
-			bool Deserialize(const Reflection::TypeDescriptorPtr& type, void* value, ISerializationReader& reader) const
+			// Appends the elements of an array, deserialized in place
+			template<typename element_t, typename allocator_t>
+			bool DeserializeRange(std::vector<element_t, allocator_t>& elements, ISerializationReader& reader) const
 			{
 				bool success = false;
-				const deserialization_strategy_t* strategy = GetDeserializationStrategy(type);
+				const uint32_t typeIndex = _typeLibrary.GetTypeIndex<element_t>();
+				const Strategy* strategy = FindStrategy(typeIndex);
 				if (ensure(strategy))
 				{
-					success = Deserialize(type, *strategy, value, reader);
+					if (IsNumberArray<element_t>(*strategy) && std::is_same_v<allocator_t, std::allocator<element_t>>)
+					{
+						success = ReadNumberArray(elements, reader);
+					}
+					else
+					{
+						success = true;
+						success &= reader.ReadBeginArray();
+						{
+							while (reader.HasArrayElementRemaining())
+							{
+								uint32_t index;
+								success &= reader.ReadBeginArrayElement(index);
+								{
+									elements.emplace_back();
+									success &= Deserialize(*strategy, typeIndex, &elements.back(), reader);
+								}
+								success &= reader.ReadEndArrayElement();
+							}
+						}
+						success &= reader.ReadEndArray();
+					}
 				}
 				return success;
 			}
@@ -114,96 +223,204 @@ namespace Reflecto
 			bool RawDeserialize(value_t& value, ISerializationReader& reader) const
 			{
 				bool success = false;
-				Reflection::TypeDescriptorPtr type = _typeLibrary.GetDescriptor<value_t>();
-				if (type)
+				const uint32_t typeIndex = _typeLibrary.GetTypeIndex<value_t>();
+				const Strategy* strategy = FindStrategy(typeIndex);
+				if (ensure(strategy))
 				{
-					success = RawDeserialize(*type, &value, reader);
+					success = RawDeserialize(*strategy, typeIndex, &value, reader);
 				}
 				return success;
 			}
 
 			bool RawDeserialize(const Reflection::TypeDescriptorPtr& type, void* value, ISerializationReader& reader) const
+			{
+				return RawDeserialize(type.get(), value, reader);
+			}
+
+			bool RawDeserialize(const Reflection::TypeDescriptor* type, void* value, ISerializationReader& reader) const
 			{
 				bool success = false;
-				const deserialization_strategy_t* strategy = GetDeserializationStrategy(type);
+				const uint32_t typeIndex = GetTypeIndex(type);
+				const Strategy* strategy = FindStrategy(typeIndex);
 				if (ensure(strategy))
 				{
-					success = RawDeserialize(type, *strategy, value, reader);
+					success = RawDeserialize(*strategy, typeIndex, value, reader);
 				}
 				return success;
 			}
 
 			bool RawDeserialize(const Reflection::TypeDescriptorPtr& type, std::any& value, ISerializationReader& reader) const
+			{
+				return RawDeserialize(type.get(), value, reader);
+			}
+
+			bool RawDeserialize(const Reflection::TypeDescriptor* type, std::any& value, ISerializationReader& reader) const
+			{
+				bool success = false;
+				const uint32_t typeIndex = GetTypeIndex(type);
+				const Strategy* strategy = FindStrategy(typeIndex);
+				// Types that are not default constructible cannot be instanciated here
+				if (ensure(strategy) && ensure(strategy->anyCast) && ensure(type->GetConstructor()))
+				{
+					// Instanciate to retrieve address
+					value = std::move(*(type->GetConstructor()->NewWeakInstance()));
+
+					// Retrieve address
+					void* address = strategy->anyCast(strategy->context, value);
+
+					// Deserialize at address
+					success = RawDeserialize(*strategy, typeIndex, address, reader);
+				}
+				return success;
+			}
+
+			// Constructs the value in place, inline when it fits, then deserializes at its address
+			template<size_t inline_size>
+			bool RawDeserialize(const Reflection::TypeDescriptor* type, Reflection::BasicReflectedValue<inline_size>& value, ISerializationReader& reader) const
 			{
 				bool success = false;
-				const deserialization_strategy_t* deserialization_strategy = GetDeserializationStrategy(type);
-				const any_cast_raw_strategy_t* any_cast_raw_strategy = GetAnyCastRawStrategy(type);
-				if (ensure(deserialization_strategy) && ensure(any_cast_raw_strategy))
+				const uint32_t typeIndex = GetTypeIndex(type);
+				const Strategy* strategy = FindStrategy(typeIndex);
+				if (ensure(strategy) && value.Emplace(type))
 				{
-					success = RawDeserialize(type, *deserialization_strategy, *any_cast_raw_strategy, value, reader);
+					success = RawDeserialize(*strategy, typeIndex, value.GetAddress(), reader);
 				}
 				return success;
 			}
 
 		private:
-			bool RawSerialize(const Reflection::TypeDescriptorPtr& type, const serialization_strategy_t& strategy, const void* value, ISerializationWriter& writer) const
+			// Primitives are dispatched by kind and objects by plan, only other strategies are called
+			bool RawSerialize(const Strategy& strategy, uint32_t typeIndex, const void* value, ISerializationWriter& writer) const
+			{
+				bool success = false;
+				switch (strategy.kind)
+				{
+				case StrategyKind::Strategy: success = strategy.serialize(strategy.context, *this, value, writer); break;
+				case StrategyKind::Object: success = GetPlans().Serialize(*this, GetPlans().FindPlan(typeIndex), value, writer); break;
+				default: success = StrategyKindExt::WritePrimitive(strategy.kind, value, writer); break;
+				}
+				return success;
+			}
+
+			bool RawDeserialize(const Strategy& strategy, uint32_t typeIndex, void* value, ISerializationReader& reader) const
+			{
+				// Deserialize at address
+				bool success = false;
+				switch (strategy.kind)
+				{
+				case StrategyKind::Strategy: success = strategy.deserialize(strategy.context, *this, value, reader); break;
+				case StrategyKind::Object: success = GetPlans().Deserialize(*this, GetPlans().FindPlan(typeIndex), value, reader); break;
+				default: success = StrategyKindExt::ReadPrimitive(strategy.kind, value, reader); break;
+				}
+				return success;
+			}
+
+			template<typename element_t>
+			bool IsNumberArray(const Strategy& strategy) const
+			{
+				return NumberKindOf<element_t>::isNumber && strategy.kind == NumberKindOf<element_t>::value && _serializationFormat == SerializationFormat::Short;
+			}
+
+			template<typename element_t>
+			static bool WriteNumberArray(const element_t* elements, size_t count, ISerializationWriter& writer)
+			{
+				bool success = false;
+				if constexpr (std::is_same_v<element_t, int32_t>)
+				{
+					success = writer.WriteInteger32Array(elements, count);
+				}
+				else if constexpr (std::is_same_v<element_t, uint32_t>)
+				{
+					success = writer.WriteUnsignedInteger32Array(elements, count);
+				}
+				else if constexpr (std::is_same_v<element_t, float>)
+				{
+					success = writer.WriteFloatArray(elements, count);
+				}
+				else if constexpr (std::is_same_v<element_t, double>)
+				{
+					success = writer.WriteDoubleArray(elements, count);
+				}
+				return success;
+			}
+
+			template<typename element_t, typename allocator_t>
+			static bool ReadNumberArray(std::vector<element_t, allocator_t>& elements, ISerializationReader& reader)
+			{
+				bool success = false;
+				if constexpr (std::is_same_v<allocator_t, std::allocator<element_t>>)
+				{
+					if constexpr (std::is_same_v<element_t, int32_t>)
+					{
+						success = reader.ReadInteger32Array(elements);
+					}
+					else if constexpr (std::is_same_v<element_t, uint32_t>)
+					{
+						success = reader.ReadUnsignedInteger32Array(elements);
+					}
+					else if constexpr (std::is_same_v<element_t, float>)
+					{
+						success = reader.ReadFloatArray(elements);
+					}
+					else if constexpr (std::is_same_v<element_t, double>)
+					{
+						success = reader.ReadDoubleArray(elements);
+					}
+				}
+				return success;
+			}
+
+			bool Serialize(uint32_t typeIndex, const void* value, ISerializationWriter& writer) const
 			{
-				return strategy(*this, value, writer);
+				bool success = false;
+				const Strategy* strategy = FindStrategy(typeIndex);
+				if (strategy)
+				{
+					success = Serialize(*strategy, typeIndex, value, writer);
+				}
+				return success;
 			}
 
-			bool Serialize(const Reflection::TypeDescriptorPtr& type, const serialization_strategy_t& strategy, const void* value, ISerializationWriter& writer) const
+			bool Serialize(const Strategy& strategy, uint32_t typeIndex, const void* value, ISerializationWriter& writer) const
 			{
 				bool success = true;
 				if (_serializationFormat == SerializationFormat::Descriptive)
 				{
 					success &= writer.WriteBeginObject();
 					{
-						if (type)
+						success &= writer.WriteBeginObjectProperty("type");
 						{
-							success &= writer.WriteBeginObjectProperty("type");
-							{
-								success &= writer.WriteString(type->GetName());
-							}
-							success &= writer.WriteEndObjectProperty();
-
-							success &= writer.WriteBeginObjectProperty("value");
-							{
-								success &= RawSerialize(type, strategy, value, writer);
-							}
-							success &= writer.WriteEndObjectProperty();
+							success &= writer.WriteString(strategy.type->GetName());
 						}
-						else
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("value");
 						{
-							success = false;
+							success &= RawSerialize(strategy, typeIndex, value, writer);
 						}
+						success &= writer.WriteEndObjectProperty();
 					}
+					success &= writer.WriteEndObject();
 				}
 				else if (_serializationFormat == SerializationFormat::Short)
 				{
-					success &= RawSerialize(type, strategy, value, writer);
+					success &= RawSerialize(strategy, typeIndex, value, writer);
 				}
 				return success;
 			}
 
-			bool RawDeserialize(const Reflection::TypeDescriptorPtr& type, const deserialization_strategy_t& deserialization_strategy, void* value, ISerializationReader& reader) const
-			{
-				// Deserialize at address
-				return deserialization_strategy(*this, value, reader);
-			}
-
-			bool RawDeserialize(const Reflection::TypeDescriptorPtr& type, const deserialization_strategy_t& deserialization_strategy, const any_cast_raw_strategy_t& any_cast_raw_strategy, std::any& value, ISerializationReader& reader) const
+			bool Deserialize(uint32_t typeIndex, void* value, ISerializationReader& reader) const
 			{
-				// Instanciate to retrieve address
-				value = *(type->GetConstructor()->NewWeakInstance());
-
-				// Retrieve address
-				void* address = any_cast_raw_strategy(value);
-
-				// Deserialize at address
-				return RawDeserialize(type, deserialization_strategy, address, reader);
+				bool success = false;
+				const Strategy* strategy = FindStrategy(typeIndex);
+				if (ensure(strategy))
+				{
+					success = Deserialize(*strategy, typeIndex, value, reader);
+				}
+				return success;
 			}
 
-			bool Deserialize(const Reflection::TypeDescriptorPtr& type, const deserialization_strategy_t& strategy, void* value, ISerializationReader& reader) const
+			bool Deserialize(const Strategy& strategy, uint32_t typeIndex, void* value, ISerializationReader& reader) const
 			{
 				bool success = true;
 				SerializationFormat currentFormatSerializationFormat = _serializationFormat;
@@ -213,59 +430,51 @@ namespace Reflecto
 					{
 						while (reader.HasObjectPropertyRemaining())
 						{
-							if (type)
+							std::string property;
+							success &= reader.ReadBeginObjectProperty(property);
 							{
-								std::string property;
-								success &= reader.ReadBeginObjectProperty(property);
+								if (property == "type")
 								{
-									if (property == "type")
-									{
-										std::string actualType;
-										success &= reader.ReadString(actualType);
-										assert(type->GetName() == actualType);
-									}
-									else if (property == "value")
-									{
-										success &= RawDeserialize(type, strategy, value, reader);
-									}
+									std::string actualType;
+									success &= reader.ReadString(actualType);
+									assert(strategy.type->GetName() == actualType);
+								}
+								else if (property == "value")
+								{
+									success &= RawDeserialize(strategy, typeIndex, value, reader);
 								}
-								success &= reader.ReadEndObjectProperty();
-							}
-							else
-							{
-								success = false;
 							}
+							success &= reader.ReadEndObjectProperty();
 						}
 					}
 					success &= reader.ReadEndObject();
 				}
 				else if (currentFormatSerializationFormat == SerializationFormat::Short)
 				{
-					success &= RawDeserialize(type, strategy, value, reader);
+					success &= RawDeserialize(strategy, typeIndex, value, reader);
 				}
 				return success;
 			}
 
-			const serialization_strategy_t* GetSerializationStrategy(const Reflection::TypeDescriptorPtr& type) const
+			uint32_t GetTypeIndex(const Reflection::TypeDescriptor* type) const
 			{
-				strategy_map_t::const_iterator found = _strategies.find(type);
-				return found != _strategies.end() ? &std::get<serialization_strategy_t>((*found).second) : nullptr;
+				return type ? _typeLibrary.GetTypeIndex(type->GetHash()) : Reflection::TypeLibraryIndex::kInvalidPosition;
 			}
 
-			const deserialization_strategy_t* GetDeserializationStrategy(const Reflection::TypeDescriptorPtr& type) const
+			const Strategy* FindStrategy(uint32_t typeIndex) const
 			{
-				strategy_map_t::const_iterator found = _strategies.find(type);
-				return found != _strategies.end() ? &std::get<deserialization_strategy_t>((*found).second) : nullptr;
+				return typeIndex < _strategies.size() && _strategies[typeIndex].type ? &_strategies[typeIndex] : nullptr;
 			}
 
-			const any_cast_raw_strategy_t* GetAnyCastRawStrategy(const Reflection::TypeDescriptorPtr& type) const
+			const SerializationPlans& GetPlans() const
 			{
-				strategy_map_t::const_iterator found = _strategies.find(type);
-				return found != _strategies.end() ? &std::get<any_cast_raw_strategy_t>((*found).second) : nullptr;
+				return _plans[static_cast<size_t>(_serializationFormat)];
 			}
 
 			Reflection::TypeLibrary _typeLibrary;
-			strategy_map_t _strategies;
+			strategy_table_t _strategies;
+			strategy_owners_t _owners;
+			std::array<SerializationPlans, 2> _plans;
 			SerializationFormat _serializationFormat;
 		};
 	}
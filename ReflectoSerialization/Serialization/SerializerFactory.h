@@ -5,7 +5,11 @@
 #include "Common/Ensure.h"
 #include "Type/TypeLibrary.h"
 
-using namespace std::placeholders;
+#include <any>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
 
 namespace Reflecto
 {
@@ -21,33 +25,48 @@ namespace Reflecto
 
 			SerializerFactory(const Reflection::TypeLibrary& library)
 				: _typeLibrary(library)
+				, _strategies(library.GetDescriptors().size())
 				, _format(SerializationFormat::Descriptive)
 			{ }
 
 			SerializerFactory& LearnType(const Reflection::TypeDescriptorPtr& type, const serialization_strategy_t& serializationStrategy, const deserialization_strategy_t& deserializationStrategy, const any_cast_raw_strategy_t& anyCastRawStrategy)
 			{
-				_strategies.insert({ type, strategies_t(serializationStrategy, deserializationStrategy, anyCastRawStrategy) });
+				return LearnType(type.get(), serializationStrategy, deserializationStrategy, anyCastRawStrategy);
+			}
+
+			SerializerFactory& LearnType(const Reflection::TypeDescriptor* type, const serialization_strategy_t& serializationStrategy, const deserialization_strategy_t& deserializationStrategy, const any_cast_raw_strategy_t& anyCastRawStrategy)
+			{
+				Serializer::Strategy* strategy = FindUnlearnedStrategy(type);
+				if (strategy)
+				{
+					// Functions are owned by the serializer and called through their context
+					std::shared_ptr<const strategies_t> functions = std::make_shared<const strategies_t>(serializationStrategy, deserializationStrategy, anyCastRawStrategy);
+					*strategy = Serializer::Strategy{ type, StrategyKind::Strategy, functions.get(), &SerializeFunction, &DeserializeFunction, &AnyCastFunction };
+					_owners.push_back(std::move(functions));
+				}
 				return *this;
 			}
 
 			template<typename value_t, typename strategy_t>
 			SerializerFactory& LearnType()
 			{
-				const Reflection::TypeDescriptorPtr& type = _typeLibrary.GetDescriptor<value_t>();
-
-				serialization_strategy_t serializationStrategy = std::bind(&strategy_t::Serialize, type, _1, _2, _3);
-				deserialization_strategy_t deserializationStrategy = std::bind(&strategy_t::Deserialize, type, _1, _2, _3);
-				any_cast_raw_strategy_t anyCastRawStrategy = [] (std::any& any) -> void* {
-					return &std::any_cast<value_t&>(any);
-				};
-
-				return LearnType<value_t>(serializationStrategy, deserializationStrategy, anyCastRawStrategy);
+				const Reflection::TypeDescriptor* type = _typeLibrary.FindDescriptor<value_t>();
+				if (ensure(type))
+				{
+					Serializer::Strategy* strategy = FindUnlearnedStrategy(type);
+					if (strategy)
+					{
+						// Strategies borrow the descriptor, which the serializer's library keeps alive
+						*strategy = Serializer::Strategy{ type, StrategyKindOf<strategy_t>::value, type, &SerializeStrategy<strategy_t>, &DeserializeStrategy<strategy_t>, &AnyCast<value_t> };
+					}
+				}
+				return *this;
 			}
 
 			template<class value_t>
 			SerializerFactory& LearnType(serialization_strategy_t serializationStrategy, deserialization_strategy_t deserializationStrategy, const any_cast_raw_strategy_t& anyCastRawStrategy)
 			{
-				const Reflection::TypeDescriptorPtr type = _typeLibrary.GetDescriptor<value_t>();
+				const Reflection::TypeDescriptor* type = _typeLibrary.FindDescriptor<value_t>();
 				LearnType(type, serializationStrategy, deserializationStrategy, anyCastRawStrategy);
 				return *this;
 			}
@@ -60,12 +79,58 @@ namespace Reflecto
 
 			Serializer Build()
 			{
-				return Serializer(_typeLibrary, _strategies, _format);
+				return Serializer(_typeLibrary, _strategies, _owners, _format);
 			}
 
 		private:
+			// Only the strategy learned first for a type is kept
+			Serializer::Strategy* FindUnlearnedStrategy(const Reflection::TypeDescriptor* type)
+			{
+				Serializer::Strategy* found = nullptr;
+				const uint32_t typeIndex = type ? _typeLibrary.GetTypeIndex(type->GetHash()) : Reflection::TypeLibraryIndex::kInvalidPosition;
+				if (ensure(typeIndex < _strategies.size()) && !_strategies[typeIndex].type)
+				{
+					found = &_strategies[typeIndex];
+				}
+				return found;
+			}
+
+			template<typename strategy_t>
+			static bool SerializeStrategy(const void* context, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			{
+				return strategy_t::Serialize(*static_cast<const Reflection::TypeDescriptor*>(context), serializer, value, writer);
+			}
+
+			template<typename strategy_t>
+			static bool DeserializeStrategy(const void* context, const Serializer& serializer, void* value, ISerializationReader& reader)
+			{
+				return strategy_t::Deserialize(*static_cast<const Reflection::TypeDescriptor*>(context), serializer, value, reader);
+			}
+
+			template<typename value_t>
+			static void* AnyCast(const void* context, std::any& any)
+			{
+				return &std::any_cast<value_t&>(any);
+			}
+
+			static bool SerializeFunction(const void* context, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			{
+				return std::get<serialization_strategy_t>(*static_cast<const strategies_t*>(context))(serializer, value, writer);
+			}
+
+			static bool DeserializeFunction(const void* context, const Serializer& serializer, void* value, ISerializationReader& reader)
+			{
+				return std::get<deserialization_strategy_t>(*static_cast<const strategies_t*>(context))(serializer, value, reader);
+			}
+
+			static void* AnyCastFunction(const void* context, std::any& any)
+			{
+				return std::get<any_cast_raw_strategy_t>(*static_cast<const strategies_t*>(context))(any);
+			}
+
 			Reflection::TypeLibrary _typeLibrary;
-			Serializer::strategy_map_t _strategies;
+			Serializer::strategy_table_t _strategies;
+			Serializer::strategy_owners_t _owners;
 			SerializationFormat _format;
 		};
 	}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Serialization/Blob.h"
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		template<typename object_t, typename member_t>
+		struct StaticMember
+		{
+			constexpr StaticMember(const char* name, member_t object_t::* pointer)
+				: name(name)
+				, pointer(pointer)
+			{ }
+
+			const char* name;
+			member_t object_t::* pointer;
+		};
+
+		// Compile time registration of an object type, specialized with its members in the order
+		// they are registered in the type library, e.g.
+		//   template<> struct StaticTypeRegistration<Toy>
+		//   {
+		//       static constexpr auto kMembers = std::make_tuple(StaticMember("Id", &Toy::Id), StaticMember("Name", &Toy::Name));
+		//   };
+		template<typename object_t>
+		struct StaticTypeRegistration;
+
+		// Serializes types known at compile time with the writer as a template parameter, so that
+		// writing a struct inlines into straight line code. Writer functions are called qualified,
+		// which bypasses virtual dispatch. Output is identical to a Serializer in the short format
+		// whose types use the built-in strategies.
+		template<typename value_t, typename writer_t>
+		class StaticSerializer
+		{
+		public:
+			static bool Serialize(const value_t& value, writer_t& writer)
+			{
+				return Write(value, writer);
+			}
+
+		private:
+			template<typename type_t>
+			struct IsVector : std::false_type { };
+
+			template<typename element_t, typename allocator_t>
+			struct IsVector<std::vector<element_t, allocator_t>> : std::true_type { };
+
+			template<typename type_t>
+			struct IsMap : std::false_type { };
+
+			template<typename key_t, typename mapped_t, typename compare_t, typename allocator_t>
+			struct IsMap<std::map<key_t, mapped_t, compare_t, allocator_t>> : std::true_type { };
+
+			template<typename type_t>
+			struct IsOptional : std::false_type { };
+
+			template<typename element_t>
+			struct IsOptional<std::optional<element_t>> : std::true_type { };
+
+			template<typename type_t>
+			static bool Write(const type_t& value, writer_t& writer)
+			{
+				bool success = true;
+				if constexpr (std::is_same_v<type_t, int32_t>)
+				{
+					success = writer.writer_t::WriteInteger32(value);
+				}
+				else if constexpr (std::is_same_v<type_t, uint32_t>)
+				{
+					success = writer.writer_t::WriteUnsignedInteger32(value);
+				}
+				else if constexpr (std::is_same_v<type_t, float>)
+				{
+					success = writer.writer_t::WriteFloat(value);
+				}
+				else if constexpr (std::is_same_v<type_t, double>)
+				{
+					success = writer.writer_t::WriteDouble(value);
+				}
+				else if constexpr (std::is_same_v<type_t, bool>)
+				{
+					success = writer.writer_t::WriteBoolean(value);
+				}
+				else if constexpr (std::is_same_v<type_t, std::string>)
+				{
+					success = writer.writer_t::WriteString(value);
+				}
+				else if constexpr (std::is_same_v<type_t, Blob>)
+				{
+					success = writer.writer_t::WriteBytes(value.GetBytes());
+				}
+				else if constexpr (IsVector<type_t>::value)
+				{
+					success &= writer.writer_t::WriteBeginArray();
+					for (const auto& element : value)
+					{
+						success &= writer.writer_t::WriteBeginArrayElement();
+						success &= Write(element, writer);
+						success &= writer.writer_t::WriteEndArrayElement();
+					}
+					success &= writer.writer_t::WriteEndArray();
+				}
+				else if constexpr (IsMap<type_t>::value)
+				{
+					// Same layout as the map strategy, an array of key and value objects
+					success &= writer.writer_t::WriteBeginArray();
+					for (const auto& element : value)
+					{
+						success &= writer.writer_t::WriteBeginArrayElement();
+						success &= writer.writer_t::WriteBeginObject();
+						success &= writer.writer_t::WriteBeginObjectProperty(kKeyProperty);
+						success &= Write(element.first, writer);
+						success &= writer.writer_t::WriteEndObjectProperty();
+						success &= writer.writer_t::WriteBeginObjectProperty(kValueProperty);
+						success &= Write(element.second, writer);
+						success &= writer.writer_t::WriteEndObjectProperty();
+						success &= writer.writer_t::WriteEndObject();
+						success &= writer.writer_t::WriteEndArrayElement();
+					}
+					success &= writer.writer_t::WriteEndArray();
+				}
+				else if constexpr (IsOptional<type_t>::value)
+				{
+					success = value ? writer.writer_t::WritePresent() && Write(*value, writer) : writer.writer_t::WriteNull();
+				}
+				else
+				{
+					constexpr size_t memberCount = std::tuple_size_v<std::decay_t<decltype(StaticTypeRegistration<type_t>::kMembers)>>;
+					success &= writer.writer_t::WriteBeginObject();
+					success &= WriteMembers(value, writer, std::make_index_sequence<memberCount>());
+					success &= writer.writer_t::WriteEndObject();
+				}
+				return success;
+			}
+
+			template<typename object_t, size_t... indices>
+			static bool WriteMembers(const object_t& object, writer_t& writer, std::index_sequence<indices...>)
+			{
+				bool success = true;
+				((success &= WriteMember<object_t, indices>(object, writer)), ...);
+				return success;
+			}
+
+			template<typename object_t, size_t index>
+			static bool WriteMember(const object_t& object, writer_t& writer)
+			{
+				constexpr auto member = std::get<index>(StaticTypeRegistration<object_t>::kMembers);
+				bool success = true;
+				success &= writer.writer_t::WriteBeginObjectProperty(kMemberName<object_t, index>);
+				success &= Write(object.*(member.pointer), writer);
+				success &= writer.writer_t::WriteEndObjectProperty();
+				return success;
+			}
+
+			// Writers take names as strings, built once per member rather than on every write
+			template<typename object_t, size_t index>
+			inline static const std::string kMemberName = std::get<index>(StaticTypeRegistration<object_t>::kMembers).name;
+
+			inline static const std::string kKeyProperty = "key";
+			inline static const std::string kValueProperty = "value";
+		};
+	}
+}
@@ -1,15 +1,20 @@
 #pragma once
 
+#include "Serialization/Blob.h"
 #include "Serialization/Serializer.h"
 #include "Serialization/Reader/ISerializationReader.h"
 #include "Serialization/Writer/ISerializationWriter.h"
 
+#include "Common/Definitions.h"
 #include "Common/Ensure.h"
 #include "Type/MemberDescriptor.h"
+#include "Type/TypeLibrary.h"
 #include "Type/ValueDescriptor.h"
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace Reflecto
 {
@@ -17,13 +22,15 @@ namespace Reflecto
 	{
 		struct Int32SerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::Integer32;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				const int32_t& valInt = *static_cast<const int32_t*>(value);
 				return writer.WriteInteger32(valInt);
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				int32_t& valInt = *static_cast<int32_t*>(value);
 				return reader.ReadInteger32(valInt);
@@ -32,13 +39,15 @@ namespace Reflecto
 
 		struct UInt32SerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::UnsignedInteger32;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				const uint32_t& valInt = *static_cast<const uint32_t*>(value);
 				return writer.WriteUnsignedInteger32(valInt);
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				uint32_t& valInt = *static_cast<uint32_t*>(value);
 				return reader.ReadUnsignedInteger32(valInt);
@@ -47,28 +56,49 @@ namespace Reflecto
 
 		struct StringSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::String;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				const std::string& valueStr = *static_cast<const std::string*>(value);
 				return writer.WriteString(valueStr);
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				std::string& valueStr = *static_cast<std::string*>(value);
 				return reader.ReadString(valueStr);
 			}
 		};
 
+		struct BlobSerializationStrategy
+		{
+			static constexpr StrategyKind kKind = StrategyKind::Blob;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			{
+				const Blob& blob = *static_cast<const Blob*>(value);
+				return writer.WriteBytes(blob.GetBytes());
+			}
+
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			{
+				Blob& blob = *static_cast<Blob*>(value);
+				return reader.ReadBytes(blob.GetStorage());
+			}
+		};
+
 		struct FloatSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::Float;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				const float& valueStr = *static_cast<const float*>(value);
 				return writer.WriteFloat(valueStr);
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				float& valueStr = *static_cast<float*>(value);
 				return reader.ReadFloat(valueStr);
@@ -77,13 +107,15 @@ namespace Reflecto
 
 		struct DoubleSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::Double;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				const double& valueStr = *static_cast<const double*>(value);
 				return writer.WriteDouble(valueStr);
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				double& valueStr = *static_cast<double*>(value);
 				return reader.ReadDouble(valueStr);
@@ -92,13 +124,15 @@ namespace Reflecto
 
 		struct BooleanSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::Boolean;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				const bool& valueBoolean = *static_cast<const bool*>(value);
 				return writer.WriteBoolean(valueBoolean);
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				bool& valueBoolean = *static_cast<bool*>(value);
 				return reader.ReadBoolean(valueBoolean);
@@ -108,20 +142,25 @@ namespace Reflecto
 		template<class object_t>
 		struct ObjectSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static constexpr StrategyKind kKind = StrategyKind::Object;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				bool success = true;
-				const object_t& valueObject = *static_cast<const object_t*>(value);
+				const byte* valueObject = static_cast<const byte*>(value);
 				success &= writer.WriteBeginObject();
 				{
-					if (typeDescriptor)
+					const Reflection::TypeLibrary& library = serializer.GetTypeLibrary();
+					const uint32_t typeIndex = library.GetTypeIndex(typeDescriptor.GetHash());
+					if (ensure(typeIndex != Reflection::TypeLibraryIndex::kInvalidPosition))
 					{
-						for (const Reflection::MemberDescriptor& member : typeDescriptor->GetMembers())
+						const Reflection::TypeLibraryLayout& layout = library.GetLayout();
+						for (const Reflection::MemberLayout& member : layout.GetMembers(typeIndex))
 						{
-							success &= writer.WriteBeginObjectProperty(member.GetName());
+							success &= writer.WriteBeginObjectProperty(layout.GetMemberDescriptor(member).GetName());
 							{
-								const void* value = member.ResolveMember(valueObject);
-								success &= serializer.Serialize(member.GetType(), value, writer);
+								const void* value = layout.ResolveMember(member, valueObject);
+								success &= serializer.Serialize(library.FindDescriptorAt(member.typeIndex), value, writer);
 							}
 							success &= writer.WriteEndObjectProperty();
 						}
@@ -135,7 +174,7 @@ namespace Reflecto
 				return success;
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				bool success = true;
 				object_t& valueObject = *static_cast<object_t*>(value);
@@ -146,18 +185,11 @@ namespace Reflecto
 						std::string propertyName;
 						success &= reader.ReadBeginObjectProperty(propertyName);
 						{
-							if (typeDescriptor)
-							{
-								const Reflection::MemberDescriptor* memberDescriptor = typeDescriptor->GetMemberByNameRecursive(propertyName);
-								if (ensure(memberDescriptor))
-								{
-									void* member = memberDescriptor->ResolveMember<object_t>(valueObject);
-									success &= serializer.Deserialize(memberDescriptor->GetType(), member, reader);
-								}
-							}
-							else
+							const Reflection::MemberDescriptor* memberDescriptor = typeDescriptor.GetMemberByNameRecursive(propertyName);
+							if (ensure(memberDescriptor))
 							{
-								success &= false;
+								void* member = memberDescriptor->ResolveMember<object_t>(valueObject);
+								success &= serializer.Deserialize(memberDescriptor->GetType(), member, reader);
 							}
 						}
 						success &= reader.ReadEndObjectProperty();
@@ -171,49 +203,63 @@ namespace Reflecto
 		template<class object_t>
 		struct VectorSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
-			{
-				using element_t = typename object_t::value_type;
+			using element_t = typename object_t::value_type;
 
+			// vector<bool> packs its elements, which have no address to serialize from or into
+			static constexpr bool kContiguous = !std::is_same_v<element_t, bool>;
+
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			{
 				bool success = true;
 				const object_t& valueObject = *static_cast<const object_t*>(value);
-				success &= writer.WriteBeginArray();
+				if constexpr (kContiguous)
 				{
-					for (const element_t& element : valueObject)
+					success &= serializer.SerializeRange(valueObject.data(), valueObject.size(), writer);
+				}
+				else
+				{
+					success &= writer.WriteBeginArray();
 					{
-						success &= writer.WriteBeginArrayElement();
+						for (const element_t element : valueObject)
 						{
-							success &= serializer.Serialize(element, writer);
+							success &= writer.WriteBeginArrayElement();
+							{
+								success &= serializer.Serialize(element, writer);
+							}
+							success &= writer.WriteEndArrayElement();
 						}
-						success &= writer.WriteEndArrayElement();
 					}
+					success &= writer.WriteEndArray();
 				}
-				success &= writer.WriteEndArray();
 				return success;
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
-				using element_t = typename object_t::value_type;
-
 				bool success = true;
-
 				object_t& collection = *static_cast<object_t*>(value);
-				success &= reader.ReadBeginArray();
+				if constexpr (kContiguous)
 				{
-					while (reader.HasArrayElementRemaining())
+					success &= serializer.DeserializeRange(collection, reader);
+				}
+				else
+				{
+					success &= reader.ReadBeginArray();
 					{
-						uint32_t index;
-						success &= reader.ReadBeginArrayElement(index);
+						while (reader.HasArrayElementRemaining())
 						{
-							element_t element;
-							success &= serializer.Deserialize<element_t>(element, reader);
-							collection.push_back(element);
+							uint32_t index;
+							success &= reader.ReadBeginArrayElement(index);
+							{
+								element_t element;
+								success &= serializer.Deserialize<element_t>(element, reader);
+								collection.push_back(element);
+							}
+							success &= reader.ReadEndArrayElement();
 						}
-						success &= reader.ReadEndArrayElement();
 					}
+					success &= reader.ReadEndArray();
 				}
-				success &= reader.ReadEndArray();
 				return success;
 			}
 		};
@@ -221,7 +267,7 @@ namespace Reflecto
 		template<class object_t>
 		struct MapSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				using element_t = typename object_t::value_type;
 
@@ -257,7 +303,7 @@ namespace Reflecto
 				return success;
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				using element_t = typename object_t::value_type;
 				using key_t = typename object_t::key_type;
@@ -308,24 +354,21 @@ namespace Reflecto
 		template<class enum_t>
 		struct EnumSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				bool success = false;
-				if (typeDescriptor)
+				const enum_t& valueEnum = *static_cast<const enum_t*>(value);
+				const Reflection::ValueDescriptor* valueDescriptor = typeDescriptor.GetValueByValue(valueEnum);
+				if (valueDescriptor)
 				{
-					const enum_t& valueEnum = *static_cast<const enum_t*>(value);
-					const Reflection::ValueDescriptor* valueDescriptor = typeDescriptor->GetValueByValue(valueEnum);
-					if (valueDescriptor)
-					{
-						std::string enumValueString = valueDescriptor->GetName();
-						success = writer.WriteString(enumValueString);
-					}
+					std::string enumValueString = valueDescriptor->GetName();
+					success = writer.WriteString(enumValueString);
 				}
 
 				return success;
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				bool success = false;
 
@@ -334,14 +377,11 @@ namespace Reflecto
 				std::string enumValueString;
 				if (reader.ReadString(enumValueString))
 				{
-					if (typeDescriptor)
+					const Reflection::ValueDescriptor* valueDescriptor = typeDescriptor.GetValueByName(enumValueString);
+					if (valueDescriptor)
 					{
-						const Reflection::ValueDescriptor* valueDescriptor = typeDescriptor->GetValueByName(enumValueString);
-						if (valueDescriptor)
-						{
-							valueEnum = valueDescriptor->GetValue<enum_t>();
-							success = true;
-						}
+						valueEnum = valueDescriptor->GetValue<enum_t>();
+						success = true;
 					}
 				}
 				
@@ -353,7 +393,7 @@ namespace Reflecto
 		template<class object_t>
 		struct OptionalSerializationStrategy
 		{
-			static bool Serialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
+			static bool Serialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, const void* value, ISerializationWriter& writer)
 			{
 				using element_t = typename object_t::value_type;
 
@@ -361,22 +401,37 @@ namespace Reflecto
 				const object_t& valueOptional = *static_cast<const object_t*>(value);
 				if (valueOptional)
 				{
+					success &= writer.WritePresent();
 					success &= serializer.Serialize(valueOptional.value(), writer);
 				}
+				else
+				{
+					// Properties and elements must have a value
+					success &= writer.WriteNull();
+				}
 				return success;
 			}
 
-			static bool Deserialize(const Reflection::TypeDescriptorPtr& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
+			static bool Deserialize(const Reflection::TypeDescriptor& typeDescriptor, const Serializer& serializer, void* value, ISerializationReader& reader)
 			{
 				using element_t = typename object_t::value_type;
 
 				bool success = true;
 
+				// Null is checked first, readers leave their input as is when it is not there
 				object_t& valueOptional = *static_cast<object_t*>(value);
-				element_t val;
-				if (success &= serializer.Deserialize(val, reader))
+				if (reader.ReadNull(value))
 				{
-					valueOptional = val;
+					valueOptional.reset();
+				}
+				else
+				{
+					element_t val;
+					success &= reader.ReadPresent() && serializer.Deserialize(val, reader);
+					if (success)
+					{
+						valueOptional = std::move(val);
+					}
 				}
 
 				return success;
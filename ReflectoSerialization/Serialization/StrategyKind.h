@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Serialization/Blob.h"
+#include "Serialization/Reader/ISerializationReader.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// What a learned strategy does. Primitives are read and written through a switch rather
+		// than an indirect call, objects go through their compiled plan and anything else calls
+		// the strategy.
+		enum class StrategyKind : uint8_t
+		{
+			Strategy,
+			Integer32,
+			UnsignedInteger32,
+			Float,
+			Double,
+			Boolean,
+			String,
+			Blob,
+			Object
+		};
+
+		// Kind of a strategy, from its kKind when it declares one
+		template<typename strategy_t, typename = void>
+		struct StrategyKindOf
+		{
+			static constexpr StrategyKind value = StrategyKind::Strategy;
+		};
+
+		template<typename strategy_t>
+		struct StrategyKindOf<strategy_t, std::void_t<decltype(strategy_t::kKind)>>
+		{
+			static constexpr StrategyKind value = strategy_t::kKind;
+		};
+
+		// Kind of the built-in strategy of numbers that can be written as arrays at once
+		template<typename value_t>
+		struct NumberKindOf
+		{
+			static constexpr bool isNumber = std::is_same_v<value_t, int32_t> || std::is_same_v<value_t, uint32_t> || std::is_same_v<value_t, float> || std::is_same_v<value_t, double>;
+			static constexpr StrategyKind value =
+				std::is_same_v<value_t, int32_t> ? StrategyKind::Integer32 :
+				std::is_same_v<value_t, uint32_t> ? StrategyKind::UnsignedInteger32 :
+				std::is_same_v<value_t, float> ? StrategyKind::Float :
+				std::is_same_v<value_t, double> ? StrategyKind::Double :
+				StrategyKind::Strategy;
+		};
+
+		namespace StrategyKindExt
+		{
+			inline bool IsPrimitive(StrategyKind kind)
+			{
+				return kind != StrategyKind::Strategy && kind != StrategyKind::Object;
+			}
+
+			inline bool WritePrimitive(StrategyKind kind, const void* value, ISerializationWriter& writer)
+			{
+				bool success = false;
+				switch (kind)
+				{
+				case StrategyKind::Integer32: success = writer.WriteInteger32(*static_cast<const int32_t*>(value)); break;
+				case StrategyKind::UnsignedInteger32: success = writer.WriteUnsignedInteger32(*static_cast<const uint32_t*>(value)); break;
+				case StrategyKind::Float: success = writer.WriteFloat(*static_cast<const float*>(value)); break;
+				case StrategyKind::Double: success = writer.WriteDouble(*static_cast<const double*>(value)); break;
+				case StrategyKind::Boolean: success = writer.WriteBoolean(*static_cast<const bool*>(value)); break;
+				case StrategyKind::String: success = writer.WriteString(*static_cast<const std::string*>(value)); break;
+				case StrategyKind::Blob: success = writer.WriteBytes(static_cast<const Blob*>(value)->GetBytes()); break;
+				default: break;
+				}
+				return success;
+			}
+
+			inline bool ReadPrimitive(StrategyKind kind, void* value, ISerializationReader& reader)
+			{
+				bool success = false;
+				switch (kind)
+				{
+				case StrategyKind::Integer32: success = reader.ReadInteger32(*static_cast<int32_t*>(value)); break;
+				case StrategyKind::UnsignedInteger32: success = reader.ReadUnsignedInteger32(*static_cast<uint32_t*>(value)); break;
+				case StrategyKind::Float: success = reader.ReadFloat(*static_cast<float*>(value)); break;
+				case StrategyKind::Double: success = reader.ReadDouble(*static_cast<double*>(value)); break;
+				case StrategyKind::Boolean: success = reader.ReadBoolean(*static_cast<bool*>(value)); break;
+				case StrategyKind::String: success = reader.ReadString(*static_cast<std::string*>(value)); break;
+				case StrategyKind::Blob: success = reader.ReadBytes(static_cast<Blob*>(value)->GetStorage()); break;
+				default: break;
+				}
+				return success;
+			}
+		}
+	}
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+#include "Serialization/BinaryEncoding.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Writes a compact binary encoding that is read back by BinarySerializationReader. Numbers
+		// are fixed size little endian, strings are prefixed by their varint length and objects and
+		// arrays by their varint entry count. Values carry no type tag: the reader must read them
+		// with the same types they were written with, as the serialization strategies do.
+		// Entry counts are only known once objects and arrays end, so they are inserted in a
+		// single pass when the outermost one ends.
+		class BinarySerializationWriter : public ISerializationWriter
+		{
+		public:
+			BinarySerializationWriter()
+				: BinarySerializationWriter(BinaryPropertyFormat::Name)
+			{ }
+
+			BinarySerializationWriter(BinaryPropertyFormat propertyFormat)
+				: _propertyFormat(propertyFormat)
+			{ }
+
+			virtual bool WriteInteger32(int32_t value) override
+			{
+				BinaryEncoding::AppendFixed(_buffer, value);
+				return true;
+			}
+
+			virtual bool WriteUnsignedInteger32(uint32_t value) override
+			{
+				BinaryEncoding::AppendFixed(_buffer, value);
+				return true;
+			}
+
+			virtual bool WriteInteger64(int64_t value) override
+			{
+				BinaryEncoding::AppendFixed(_buffer, value);
+				return true;
+			}
+
+			virtual bool WriteFloat(float value) override
+			{
+				BinaryEncoding::AppendFixed(_buffer, value);
+				return true;
+			}
+
+			virtual bool WriteDouble(double value) override
+			{
+				BinaryEncoding::AppendFixed(_buffer, value);
+				return true;
+			}
+
+			virtual bool WriteString(const std::string& value) override
+			{
+				BinaryEncoding::AppendString(_buffer, value);
+				return true;
+			}
+
+			// Length prefixed, like strings
+			virtual bool WriteBytes(std::string_view bytes) override
+			{
+				BinaryEncoding::AppendString(_buffer, bytes);
+				return true;
+			}
+
+			virtual bool WriteBoolean(bool value) override
+			{
+				_buffer += value ? '\x01' : '\x00';
+				return true;
+			}
+
+			// Optionals are tagged with their presence, since values carry no type tag
+			virtual bool WriteNull() override
+			{
+				_buffer += BinaryEncoding::kNullTag;
+				return true;
+			}
+
+			virtual bool WritePresent() override
+			{
+				_buffer += BinaryEncoding::kPresentTag;
+				return true;
+			}
+
+			virtual bool WriteBeginObject() override
+			{
+				return BeginFrame(FrameKind::Object);
+			}
+
+			virtual bool WriteEndObject() override
+			{
+				return EndFrame(FrameKind::Object);
+			}
+
+			virtual bool WriteBeginObjectProperty(const std::string& propertyName) override
+			{
+				bool success = BeginEntry(FrameKind::Object);
+				if (success)
+				{
+					if (_propertyFormat == BinaryPropertyFormat::Index)
+					{
+						// Unknown names get the next index and are written right after it
+						const auto [found, added] = _propertyIndexes.try_emplace(propertyName, static_cast<uint32_t>(_propertyIndexes.size()));
+						BinaryEncoding::AppendVarint(_buffer, found->second);
+						if (added)
+						{
+							BinaryEncoding::AppendString(_buffer, propertyName);
+						}
+					}
+					else
+					{
+						BinaryEncoding::AppendString(_buffer, propertyName);
+					}
+				}
+				return success;
+			}
+
+			virtual bool WriteEndObjectProperty() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Object;
+			}
+
+			virtual bool WriteBeginArray() override
+			{
+				return BeginFrame(FrameKind::Array);
+			}
+
+			virtual bool WriteEndArray() override
+			{
+				return EndFrame(FrameKind::Array);
+			}
+
+			virtual bool WriteBeginArrayElement() override
+			{
+				return BeginEntry(FrameKind::Array);
+			}
+
+			virtual bool WriteEndArrayElement() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Array;
+			}
+
+			// Elements are fixed size, so number arrays are written as one block
+			virtual bool WriteInteger32Array(const int32_t* values, size_t count) override
+			{
+				return WriteFixedArray(values, count);
+			}
+
+			virtual bool WriteUnsignedInteger32Array(const uint32_t* values, size_t count) override
+			{
+				return WriteFixedArray(values, count);
+			}
+
+			virtual bool WriteFloatArray(const float* values, size_t count) override
+			{
+				return WriteFixedArray(values, count);
+			}
+
+			virtual bool WriteDoubleArray(const double* values, size_t count) override
+			{
+				return WriteFixedArray(values, count);
+			}
+
+			// Complete once every object and array has ended
+			const std::string& GetBuffer() const
+			{
+				return _buffer;
+			}
+
+			void Reserve(size_t capacity)
+			{
+				_buffer.reserve(capacity);
+			}
+
+			// Empties the buffer while keeping its capacity, to reuse the writer
+			void Clear()
+			{
+				_buffer.clear();
+				_frames.clear();
+				_counts.clear();
+				_propertyIndexes.clear();
+			}
+
+			bool Export(std::ostream& outputStream)
+			{
+				outputStream.write(_buffer.data(), _buffer.size());
+				return _frames.empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				uint32_t count;
+				size_t start;
+				size_t slot;
+			};
+
+			// Entry count to insert at an offset of the buffer. Counts are kept in the order frames
+			// begin, which is their order in the buffer, also for frames starting at the same offset.
+			struct Count
+			{
+				size_t offset;
+				uint32_t count;
+			};
+
+			template<typename value_t>
+			bool WriteFixedArray(const value_t* values, size_t count)
+			{
+				BeginFrame(FrameKind::Array);
+				_frames.back().count = static_cast<uint32_t>(count);
+				BinaryEncoding::AppendFixedArray(_buffer, values, count);
+				return EndFrame(FrameKind::Array);
+			}
+
+			bool BeginFrame(FrameKind kind)
+			{
+				_frames.push_back(Frame{ kind, 0, _buffer.size(), _counts.size() });
+				_counts.push_back(Count{ _buffer.size(), 0 });
+				return true;
+			}
+
+			bool EndFrame(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					const Frame frame = _frames.back();
+					_counts[frame.slot].count = frame.count;
+					_frames.pop_back();
+					if (_frames.empty())
+					{
+						InsertCounts(frame.start);
+					}
+					success = true;
+				}
+				return success;
+			}
+
+			bool BeginEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					++_frames.back().count;
+					success = true;
+				}
+				return success;
+			}
+
+			// Rebuilds the buffer from start with the counts inserted at their offsets
+			void InsertCounts(size_t start)
+			{
+				const std::string content = _buffer.substr(start);
+				_buffer.resize(start);
+				_buffer.reserve(start + content.size() + _counts.size() * BinaryEncoding::kMaxVarintSize);
+
+				size_t copied = start;
+				for (const Count& count : _counts)
+				{
+					_buffer.append(content, copied - start, count.offset - copied);
+					BinaryEncoding::AppendVarint(_buffer, count.count);
+					copied = count.offset;
+				}
+				_buffer.append(content, copied - start, std::string::npos);
+				_counts.clear();
+			}
+
+			BinaryPropertyFormat _propertyFormat;
+			std::string _buffer;
+			std::vector<Frame> _frames;
+			std::vector<Count> _counts;
+			std::unordered_map<std::string, uint32_t> _propertyIndexes;
+		};
+	}
+}
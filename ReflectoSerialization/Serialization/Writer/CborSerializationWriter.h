@@ -0,0 +1,336 @@
+#pragma once
+
+#include "Serialization/CborEncoding.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Writes CBOR in the core deterministic encoding of RFC 8949: heads with their shortest
+		// argument, floats in the shortest of half, single and double precision that keeps their
+		// value, definite lengths only and map keys sorted by their encoded bytes. Identical objects
+		// therefore give identical bytes, whatever the order their properties were written in.
+		// Entries are written straight into the buffer. A one byte head is reserved when a map or an
+		// array begins and widened when it ends with more entries, and the entries of a map are
+		// reordered in place when their keys were not written in order. When a key repeats, the
+		// last value written for it is kept.
+		class CborSerializationWriter : public ISerializationWriter
+		{
+		public:
+			virtual bool WriteInteger32(int32_t value) override
+			{
+				AppendInteger(value);
+				return true;
+			}
+
+			virtual bool WriteUnsignedInteger32(uint32_t value) override
+			{
+				CborEncoding::AppendHead(_buffer, CborEncoding::MajorType::UnsignedInteger, value);
+				return true;
+			}
+
+			virtual bool WriteInteger64(int64_t value) override
+			{
+				AppendInteger(value);
+				return true;
+			}
+
+			virtual bool WriteFloat(float value) override
+			{
+				AppendReal(value);
+				return true;
+			}
+
+			virtual bool WriteDouble(double value) override
+			{
+				AppendReal(value);
+				return true;
+			}
+
+			virtual bool WriteString(const std::string& value) override
+			{
+				AppendString(CborEncoding::MajorType::TextString, value);
+				return true;
+			}
+
+			// Written as a byte string rather than a text string
+			virtual bool WriteBytes(std::string_view bytes) override
+			{
+				AppendString(CborEncoding::MajorType::ByteString, bytes);
+				return true;
+			}
+
+			virtual bool WriteBoolean(bool value) override
+			{
+				_buffer += static_cast<char>(value ? CborEncoding::kTrue : CborEncoding::kFalse);
+				return true;
+			}
+
+			virtual bool WriteNull() override
+			{
+				_buffer += static_cast<char>(CborEncoding::kNull);
+				return true;
+			}
+
+			virtual bool WriteBeginObject() override
+			{
+				return BeginFrame(FrameKind::Object);
+			}
+
+			virtual bool WriteEndObject() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Object)
+				{
+					Frame& frame = _frames.back();
+					if (!frame.sorted)
+					{
+						SortProperties(frame);
+					}
+					_properties.resize(frame.firstProperty);
+					success = EndFrame(FrameKind::Object);
+				}
+				return success;
+			}
+
+			virtual bool WriteBeginObjectProperty(const std::string& propertyName) override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Object)
+				{
+					Frame& frame = _frames.back();
+					const size_t start = _buffer.size();
+					AppendString(CborEncoding::MajorType::TextString, propertyName);
+
+					// Keys written in increasing order need no reordering once the object ends
+					if (_properties.size() > frame.firstProperty && !(GetKey(_properties.back()) < GetKey(Property{ start, _buffer.size(), 0 })))
+					{
+						frame.sorted = false;
+					}
+					_properties.push_back(Property{ start, _buffer.size(), 0 });
+					++frame.count;
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool WriteEndObjectProperty() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Object && _properties.size() > _frames.back().firstProperty)
+				{
+					_properties.back().end = _buffer.size();
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool WriteBeginArray() override
+			{
+				return BeginFrame(FrameKind::Array);
+			}
+
+			virtual bool WriteEndArray() override
+			{
+				return EndFrame(FrameKind::Array);
+			}
+
+			virtual bool WriteBeginArrayElement() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Array)
+				{
+					++_frames.back().count;
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool WriteEndArrayElement() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Array;
+			}
+
+			// Complete once every object and array has ended
+			const std::string& GetBuffer() const
+			{
+				return _buffer;
+			}
+
+			void Reserve(size_t capacity)
+			{
+				_buffer.reserve(capacity);
+			}
+
+			// Empties the buffer while keeping its capacity, to reuse the writer
+			void Clear()
+			{
+				_buffer.clear();
+				_frames.clear();
+				_properties.clear();
+			}
+
+			bool Export(std::ostream& outputStream)
+			{
+				outputStream.write(_buffer.data(), _buffer.size());
+				return _frames.empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				bool sorted;
+				uint32_t count;
+				uint32_t firstProperty;
+				size_t head;
+			};
+
+			// Encoded key and value of a property, as offsets in the buffer
+			struct Property
+			{
+				size_t start;
+				size_t keyEnd;
+				size_t end;
+			};
+
+			void AppendInteger(int64_t value)
+			{
+				if (value >= 0)
+				{
+					CborEncoding::AppendHead(_buffer, CborEncoding::MajorType::UnsignedInteger, static_cast<uint64_t>(value));
+				}
+				else
+				{
+					// Negative integers encode -1 - value, which cannot overflow
+					CborEncoding::AppendHead(_buffer, CborEncoding::MajorType::NegativeInteger, static_cast<uint64_t>(-(value + 1)));
+				}
+			}
+
+			void AppendReal(double value)
+			{
+				const float single = static_cast<float>(value);
+				uint16_t half = 0;
+				if (std::isnan(value))
+				{
+					// Every NaN is written as the canonical quiet NaN
+					AppendFloat(CborEncoding::kFloat16, uint16_t(0x7E00));
+				}
+				else if (static_cast<double>(single) == value && CborEncoding::FloatToHalf(single, half))
+				{
+					AppendFloat(CborEncoding::kFloat16, half);
+				}
+				else if (static_cast<double>(single) == value)
+				{
+					AppendFloat(CborEncoding::kFloat32, single);
+				}
+				else
+				{
+					AppendFloat(CborEncoding::kFloat64, value);
+				}
+			}
+
+			template<typename value_t>
+			void AppendFloat(uint8_t type, value_t value)
+			{
+				char bytes[1 + sizeof(value_t)];
+				uint64_t bits = 0;
+				std::memcpy(&bits, &value, sizeof(value_t));
+				bytes[0] = static_cast<char>(type);
+				for (size_t i = 0; i < sizeof(value_t); ++i)
+				{
+					bytes[1 + i] = static_cast<char>(bits >> (8 * (sizeof(value_t) - 1 - i)));
+				}
+				_buffer.append(bytes, sizeof(bytes));
+			}
+
+			void AppendString(CborEncoding::MajorType major, std::string_view value)
+			{
+				CborEncoding::AppendHead(_buffer, major, value.size());
+				_buffer.append(value.data(), value.size());
+			}
+
+			std::string_view GetKey(const Property& property) const
+			{
+				return std::string_view(_buffer).substr(property.start, property.keyEnd - property.start);
+			}
+
+			bool BeginFrame(FrameKind kind)
+			{
+				_frames.push_back(Frame{ kind, true, 0, static_cast<uint32_t>(_properties.size()), _buffer.size() });
+				_buffer += '\0';
+				return true;
+			}
+
+			// Writes the head reserved when the frame began, widening it when the count no longer
+			// fits in a single byte. The frame is the last thing in the buffer, so only its own
+			// entries move.
+			bool EndFrame(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					const Frame& frame = _frames.back();
+					char bytes[CborEncoding::kMaxHeadSize];
+					const CborEncoding::MajorType major = kind == FrameKind::Object ? CborEncoding::MajorType::Map : CborEncoding::MajorType::Array;
+					const size_t size = CborEncoding::EncodeHead(major, frame.count, bytes);
+					if (size > 1)
+					{
+						_buffer.insert(frame.head + 1, size - 1, '\0');
+					}
+					_buffer.replace(frame.head, size, bytes, size);
+					_frames.pop_back();
+					success = true;
+				}
+				return success;
+			}
+
+			// Orders the entries of an object by their encoded key, keeping the last of repeated
+			// keys, and rewrites them after the reserved head
+			void SortProperties(Frame& frame)
+			{
+				const auto first = _properties.begin() + frame.firstProperty;
+				std::stable_sort(first, _properties.end(), [this](const Property& left, const Property& right) {
+					return GetKey(left) < GetKey(right);
+				});
+
+				_content.clear();
+				uint32_t count = 0;
+				for (auto property = first; property != _properties.end(); ++property)
+				{
+					const auto next = property + 1;
+					if (next == _properties.end() || GetKey(*property) != GetKey(*next))
+					{
+						_content.append(_buffer, property->start, property->end - property->start);
+						++count;
+					}
+				}
+
+				_buffer.resize(frame.head + 1);
+				_buffer += _content;
+				frame.count = count;
+			}
+
+			std::string _buffer;
+			std::string _content;
+			std::vector<Frame> _frames;
+			std::vector<Property> _properties;
+		};
+	}
+}
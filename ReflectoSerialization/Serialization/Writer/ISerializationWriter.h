@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 class ISerializationWriter
 {
@@ -18,10 +20,20 @@ public:
 
 	virtual bool WriteString(const std::string& value) = 0;
 
+	// Raw bytes written as a whole, natively by binary formats and as base64 by text formats
+	virtual bool WriteBytes(std::string_view bytes) = 0;
+
 	virtual bool WriteBoolean(bool value) = 0;
 
 	virtual bool WriteNull() = 0;
 
+	// Written before the value of an optional that has one. Formats whose values carry no type
+	// tag override it to tell the value apart from null.
+	virtual bool WritePresent()
+	{
+		return true;
+	}
+
 	virtual bool WriteBeginObject() = 0;
 
 	virtual bool WriteEndObject() = 0;
@@ -37,4 +49,42 @@ public:
 	virtual bool WriteBeginArrayElement() = 0;
 
 	virtual bool WriteEndArrayElement() = 0;
+
+	// Arrays of numbers written at once, as arrays of their elements would be. Writers
+	// override these when they can do better than one element at a time.
+	virtual bool WriteInteger32Array(const int32_t* values, size_t count)
+	{
+		return WriteNumberArray(values, count, &ISerializationWriter::WriteInteger32);
+	}
+
+	virtual bool WriteUnsignedInteger32Array(const uint32_t* values, size_t count)
+	{
+		return WriteNumberArray(values, count, &ISerializationWriter::WriteUnsignedInteger32);
+	}
+
+	virtual bool WriteFloatArray(const float* values, size_t count)
+	{
+		return WriteNumberArray(values, count, &ISerializationWriter::WriteFloat);
+	}
+
+	virtual bool WriteDoubleArray(const double* values, size_t count)
+	{
+		return WriteNumberArray(values, count, &ISerializationWriter::WriteDouble);
+	}
+
+private:
+	template<typename number_t>
+	bool WriteNumberArray(const number_t* values, size_t count, bool (ISerializationWriter::*write)(number_t))
+	{
+		bool success = true;
+		success &= WriteBeginArray();
+		for (size_t i = 0; i < count; ++i)
+		{
+			success &= WriteBeginArrayElement();
+			success &= (this->*write)(values[i]);
+			success &= WriteEndArrayElement();
+		}
+		success &= WriteEndArray();
+		return success;
+	}
 };
\ No newline at end of file
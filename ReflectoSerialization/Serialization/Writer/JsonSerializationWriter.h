@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Serialization/Base64Encoding.h"
 #include "Serialization/Writer/ISerializationWriter.h"
 
 #include "Common/Definitions.h"
@@ -46,6 +47,14 @@ namespace Reflecto
 				return PushElement(JsonElement(value));
 			}
 
+			// Written as a base64 string
+			virtual bool WriteBytes(std::string_view bytes) override
+			{
+				std::string text;
+				Base64Encoding::Encode(bytes, text);
+				return PushElement(JsonElement(text));
+			}
+
 			virtual bool WriteBoolean(bool value) override
 			{
 				return PushElement(JsonElement(value));
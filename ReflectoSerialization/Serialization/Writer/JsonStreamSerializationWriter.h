@@ -0,0 +1,525 @@
+#pragma once
+
+#include "Serialization/Base64Encoding.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+
+#include "Common/Definitions.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Writes JSON tokens to a growable buffer as the write calls arrive, without building a
+		// document. Like JsonSerializationWriter the output is compact, with object properties
+		// sorted by name and the last of duplicated names kept. Properties written out of order
+		// are moved when their object ends. Reals are printed as the shortest text that reads back
+		// the same value, floats at their own precision, so they can differ from the output of
+		// JsonSerializationWriter.
+		class JsonStreamSerializationWriter : public ISerializationWriter
+		{
+		public:
+			virtual bool WriteInteger32(int32_t value) override
+			{
+				return WriteInteger(value);
+			}
+
+			virtual bool WriteUnsignedInteger32(uint32_t value) override
+			{
+				return WriteInteger(value);
+			}
+
+			virtual bool WriteInteger64(int64_t value) override
+			{
+				return WriteInteger(value);
+			}
+
+			virtual bool WriteFloat(float value) override
+			{
+				AppendReal(value);
+				return true;
+			}
+
+			virtual bool WriteDouble(double value) override
+			{
+				AppendReal(value);
+				return true;
+			}
+
+			virtual bool WriteString(const std::string& value) override
+			{
+				AppendQuoted(value);
+				return true;
+			}
+
+			// Base64 never needs escaping
+			virtual bool WriteBytes(std::string_view bytes) override
+			{
+				_buffer += '"';
+				Base64Encoding::Encode(bytes, _buffer);
+				_buffer += '"';
+				return true;
+			}
+
+			virtual bool WriteBoolean(bool value) override
+			{
+				_buffer += value ? "true" : "false";
+				return true;
+			}
+
+			virtual bool WriteNull() override
+			{
+				_buffer += "null";
+				return true;
+			}
+
+			virtual bool WriteBeginObject() override
+			{
+				_frames.push_back(Frame{ FrameKind::Object, _buffer.size() + 1, 0, true, static_cast<uint32_t>(_properties.size()), 0, _escapedNames.size() });
+				_buffer += '{';
+				return true;
+			}
+
+			virtual bool WriteEndObject() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Object)
+				{
+					const Frame& frame = _frames.back();
+					if (!frame.sorted)
+					{
+						SortProperties(frame);
+					}
+					// Names of an object are only needed until it is sorted
+					_properties.resize(frame.firstProperty);
+					_escapedNames.resize(frame.firstEscapedName);
+					_frames.pop_back();
+					_buffer += '}';
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool WriteBeginObjectProperty(const std::string& propertyName) override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Object)
+				{
+					Frame& frame = _frames.back();
+					if (frame.count > 0)
+					{
+						_buffer += ',';
+					}
+
+					Property property = { _buffer.size(), 0, 0, static_cast<uint32_t>(propertyName.size()), false };
+					if (RequiresEscaping(propertyName))
+					{
+						// Escaped names differ from their raw bytes, which are kept aside for sorting
+						property.nameOffset = _escapedNames.size();
+						property.escaped = true;
+						_escapedNames += propertyName;
+					}
+					else
+					{
+						property.nameOffset = _buffer.size() + 1;
+					}
+					AppendQuoted(propertyName);
+					_buffer += ':';
+					frame.valueStart = _buffer.size();
+
+					// Sorted as long as each name follows the previous one
+					if (frame.count > 0 && frame.sorted)
+					{
+						frame.sorted = GetName(_properties.back()) < std::string_view(propertyName);
+					}
+					_properties.push_back(property);
+					++frame.count;
+					success = true;
+				}
+				return success;
+			}
+
+			// Fails on a property without a value, as the document writer does, and leaves it out
+			virtual bool WriteEndObjectProperty() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Object && _properties.size() > _frames.back().firstProperty)
+				{
+					Frame& frame = _frames.back();
+					success = _buffer.size() > frame.valueStart;
+					if (success)
+					{
+						_properties.back().end = _buffer.size();
+					}
+					else
+					{
+						const Property& property = _properties.back();
+						if (property.escaped)
+						{
+							_escapedNames.resize(property.nameOffset);
+						}
+						RemoveEntry(frame, property.start);
+						_properties.pop_back();
+					}
+				}
+				return success;
+			}
+
+			virtual bool WriteBeginArray() override
+			{
+				_frames.push_back(Frame{ FrameKind::Array, _buffer.size() + 1, 0, true, static_cast<uint32_t>(_properties.size()), 0, _escapedNames.size() });
+				_buffer += '[';
+				return true;
+			}
+
+			virtual bool WriteEndArray() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Array)
+				{
+					_frames.pop_back();
+					_buffer += ']';
+					success = true;
+				}
+				return success;
+			}
+
+			virtual bool WriteBeginArrayElement() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Array)
+				{
+					Frame& frame = _frames.back();
+					if (frame.count > 0)
+					{
+						_buffer += ',';
+					}
+					++frame.count;
+					frame.valueStart = _buffer.size();
+					success = true;
+				}
+				return success;
+			}
+
+			// Fails on an element without a value, as the document writer does, and leaves it out
+			virtual bool WriteEndArrayElement() override
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == FrameKind::Array)
+				{
+					Frame& frame = _frames.back();
+					success = _buffer.size() > frame.valueStart;
+					if (!success)
+					{
+						RemoveEntry(frame, frame.valueStart);
+					}
+				}
+				return success;
+			}
+
+			// Numbers need neither escaping nor sorting, so number arrays are formatted in one loop
+			virtual bool WriteInteger32Array(const int32_t* values, size_t count) override
+			{
+				return WriteNumberArray(values, count, kMaxIntegerSize, [this](int32_t value) { WriteInteger(value); });
+			}
+
+			virtual bool WriteUnsignedInteger32Array(const uint32_t* values, size_t count) override
+			{
+				return WriteNumberArray(values, count, kMaxIntegerSize, [this](uint32_t value) { WriteInteger(value); });
+			}
+
+			virtual bool WriteFloatArray(const float* values, size_t count) override
+			{
+				return WriteNumberArray(values, count, kMaxFloatSize, [this](float value) { AppendReal(value); });
+			}
+
+			virtual bool WriteDoubleArray(const double* values, size_t count) override
+			{
+				return WriteNumberArray(values, count, kMaxDoubleSize, [this](double value) { AppendReal(value); });
+			}
+
+			const std::string& GetBuffer() const
+			{
+				return _buffer;
+			}
+
+			void Reserve(size_t capacity)
+			{
+				_buffer.reserve(capacity);
+			}
+
+			// Empties the buffer while keeping its capacity, to reuse the writer
+			void Clear()
+			{
+				_buffer.clear();
+				_escapedNames.clear();
+				_frames.clear();
+				_properties.clear();
+			}
+
+			bool Export(std::ostream& outputStream)
+			{
+				outputStream.write(_buffer.data(), _buffer.size());
+				return true;
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				size_t contentStart;
+				uint32_t count;
+				bool sorted;
+				uint32_t firstProperty;
+				size_t valueStart;
+				size_t firstEscapedName;
+			};
+
+			// Property from its quoted name to the end of its value, separator excluded
+			struct Property
+			{
+				size_t start;
+				size_t end;
+				size_t nameOffset;
+				uint32_t nameLength;
+				bool escaped;
+			};
+
+			// Longest outputs of WriteInteger for 32 bits values and of AppendReal
+			static constexpr size_t kMaxIntegerSize = 11;
+			static constexpr size_t kMaxFloatSize = 15;
+			static constexpr size_t kMaxDoubleSize = 24;
+
+			template<typename number_t, typename append_t>
+			bool WriteNumberArray(const number_t* values, size_t count, size_t maxSize, const append_t& append)
+			{
+				_buffer.reserve(_buffer.size() + count * (maxSize + 1) + 2);
+				_buffer += '[';
+				for (size_t i = 0; i < count; ++i)
+				{
+					if (i > 0)
+					{
+						_buffer += ',';
+					}
+					append(values[i]);
+				}
+				_buffer += ']';
+				return true;
+			}
+
+			// Shortest text that reads back as the same value, at the precision of its own type so
+			// that floats are not written with the digits of their double conversion
+			template<typename real_t>
+			void AppendReal(real_t value)
+			{
+				if (!std::isfinite(value))
+				{
+					_buffer += std::isnan(value) ? "null" : (value < 0 ? "-1e+9999" : "1e+9999");
+				}
+				else
+				{
+					char digits[32];
+					const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+					_buffer.append(digits, result.ptr);
+
+					// Keep track that the value is a real number
+					if (std::find_if(digits, result.ptr, [](char digit) { return digit == '.' || digit == 'e'; }) == result.ptr)
+					{
+						_buffer += ".0";
+					}
+				}
+			}
+
+			template<typename integer_t>
+			bool WriteInteger(integer_t value)
+			{
+				char digits[24];
+				const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+				_buffer.append(digits, result.ptr);
+				return true;
+			}
+
+			std::string_view GetName(const Property& property) const
+			{
+				const std::string& names = property.escaped ? _escapedNames : _buffer;
+				return std::string_view(names).substr(property.nameOffset, property.nameLength);
+			}
+
+			// Removes the entry begun last along with the separator before it
+			void RemoveEntry(Frame& frame, size_t start)
+			{
+				--frame.count;
+				_buffer.resize(frame.count > 0 ? start - 1 : start);
+			}
+
+			void SortProperties(const Frame& frame)
+			{
+				std::vector<Property>::iterator begin = _properties.begin() + frame.firstProperty;
+				std::vector<Property>::iterator end = _properties.end();
+				std::stable_sort(begin, end, [&](const Property& left, const Property& right) {
+					return GetName(left) < GetName(right);
+				});
+
+				std::string& content = _scratch;
+				content.clear();
+				for (std::vector<Property>::iterator property = begin; property != end; ++property)
+				{
+					// Like a document, a property assigned twice keeps its last value
+					const std::vector<Property>::iterator next = property + 1;
+					if (next == end || GetName(*next) != GetName(*property))
+					{
+						if (!content.empty())
+						{
+							content += ',';
+						}
+						content.append(_buffer, property->start, property->end - property->start);
+					}
+				}
+				_buffer.replace(frame.contentStart, _buffer.size() - frame.contentStart, content);
+			}
+
+			static bool RequiresEscaping(std::string_view value)
+			{
+				return std::any_of(value.begin(), value.end(), [](char c) {
+					const byte code = static_cast<byte>(c);
+					return c == '\\' || c == '"' || code < 0x20 || code > 0x7F;
+				});
+			}
+
+			void AppendQuoted(std::string_view value)
+			{
+				_buffer += '"';
+				if (!RequiresEscaping(value))
+				{
+					_buffer += value;
+				}
+				else
+				{
+					AppendEscaped(value);
+				}
+				_buffer += '"';
+			}
+
+			void AppendEscaped(std::string_view value)
+			{
+				const char* end = value.data() + value.size();
+				for (const char* c = value.data(); c != end; ++c)
+				{
+					switch (*c)
+					{
+					case '"': _buffer += "\\\""; break;
+					case '\\': _buffer += "\\\\"; break;
+					case '\b': _buffer += "\\b"; break;
+					case '\f': _buffer += "\\f"; break;
+					case '\n': _buffer += "\\n"; break;
+					case '\r': _buffer += "\\r"; break;
+					case '\t': _buffer += "\\t"; break;
+					default:
+					{
+						uint32_t codepoint = DecodeUtf8(c, end);
+						if (codepoint < 0x20)
+						{
+							AppendCodeUnit(codepoint);
+						}
+						else if (codepoint < 0x80)
+						{
+							_buffer += static_cast<char>(codepoint);
+						}
+						else if (codepoint < 0x10000)
+						{
+							AppendCodeUnit(codepoint);
+						}
+						else
+						{
+							// Outside of the basic plane, encoded as a surrogate pair
+							codepoint -= 0x10000;
+							AppendCodeUnit(0xD800 + ((codepoint >> 10) & 0x3FF));
+							AppendCodeUnit(0xDC00 + (codepoint & 0x3FF));
+						}
+					}
+					break;
+					}
+				}
+			}
+
+			void AppendCodeUnit(uint32_t codeUnit)
+			{
+				static constexpr char kHexDigits[] = "0123456789abcdef";
+				const char escaped[] = {
+					'\\', 'u',
+					kHexDigits[(codeUnit >> 12) & 0xF], kHexDigits[(codeUnit >> 8) & 0xF],
+					kHexDigits[(codeUnit >> 4) & 0xF], kHexDigits[codeUnit & 0xF]
+				};
+				_buffer.append(escaped, sizeof(escaped));
+			}
+
+			// Decodes the sequence starting at c and leaves c on its last byte. Invalid
+			// sequences decode to the replacement character, as JsonCpp does.
+			static uint32_t DecodeUtf8(const char*& c, const char* end)
+			{
+				static constexpr uint32_t kReplacementCharacter = 0xFFFD;
+
+				const uint32_t first = static_cast<byte>(c[0]);
+				uint32_t codepoint = first;
+				if (first >= 0x80)
+				{
+					if (first < 0xE0)
+					{
+						if (end - c < 2)
+						{
+							return kReplacementCharacter;
+						}
+						codepoint = ((first & 0x1F) << 6) | (static_cast<uint32_t>(c[1]) & 0x3F);
+						c += 1;
+						codepoint = codepoint < 0x80 ? kReplacementCharacter : codepoint;
+					}
+					else if (first < 0xF0)
+					{
+						if (end - c < 3)
+						{
+							return kReplacementCharacter;
+						}
+						codepoint = ((first & 0x0F) << 12) | ((static_cast<uint32_t>(c[1]) & 0x3F) << 6) | (static_cast<uint32_t>(c[2]) & 0x3F);
+						c += 2;
+						const bool surrogate = codepoint >= 0xD800 && codepoint <= 0xDFFF;
+						codepoint = surrogate || codepoint < 0x800 ? kReplacementCharacter : codepoint;
+					}
+					else if (first < 0xF8)
+					{
+						if (end - c < 4)
+						{
+							return kReplacementCharacter;
+						}
+						codepoint = ((first & 0x07) << 18) | ((static_cast<uint32_t>(c[1]) & 0x3F) << 12) | ((static_cast<uint32_t>(c[2]) & 0x3F) << 6) | (static_cast<uint32_t>(c[3]) & 0x3F);
+						c += 3;
+						codepoint = codepoint < 0x10000 ? kReplacementCharacter : codepoint;
+					}
+					else
+					{
+						codepoint = kReplacementCharacter;
+					}
+				}
+				return codepoint;
+			}
+
+			std::string _buffer;
+			std::string _escapedNames;
+			std::string _scratch;
+			std::vector<Frame> _frames;
+			std::vector<Property> _properties;
+		};
+	}
+}
@@ -0,0 +1,373 @@
+#pragma once
+
+#include "Serialization/MsgPackEncoding.h"
+#include "Serialization/Writer/ISerializationWriter.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		// Writes MessagePack: integers in their smallest encoding, floats as float 32 and doubles
+		// as float 64, strings as str and objects as maps keyed by property name. Map and array
+		// headers depend on entry counts that are only known once objects and arrays end, so they
+		// are inserted in a single pass when the outermost one ends. Once the buffers have grown,
+		// a reused writer does not allocate.
+		class MsgPackSerializationWriter : public ISerializationWriter
+		{
+		public:
+			virtual bool WriteInteger32(int32_t value) override
+			{
+				AppendInteger(value);
+				return true;
+			}
+
+			virtual bool WriteUnsignedInteger32(uint32_t value) override
+			{
+				AppendUnsignedInteger(value);
+				return true;
+			}
+
+			virtual bool WriteInteger64(int64_t value) override
+			{
+				AppendInteger(value);
+				return true;
+			}
+
+			virtual bool WriteFloat(float value) override
+			{
+				MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kFloat32, value);
+				return true;
+			}
+
+			virtual bool WriteDouble(double value) override
+			{
+				MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kFloat64, value);
+				return true;
+			}
+
+			virtual bool WriteString(const std::string& value) override
+			{
+				AppendString(value);
+				return true;
+			}
+
+			// Written as bin rather than str
+			virtual bool WriteBytes(std::string_view bytes) override
+			{
+				const uint32_t size = static_cast<uint32_t>(bytes.size());
+				if (size <= UINT8_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kBin8, static_cast<uint8_t>(size));
+				}
+				else if (size <= UINT16_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kBin16, static_cast<uint16_t>(size));
+				}
+				else
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kBin32, size);
+				}
+				_buffer.append(bytes.data(), bytes.size());
+				return true;
+			}
+
+			virtual bool WriteBoolean(bool value) override
+			{
+				_buffer += static_cast<char>(value ? MsgPackEncoding::kTrue : MsgPackEncoding::kFalse);
+				return true;
+			}
+
+			virtual bool WriteNull() override
+			{
+				_buffer += static_cast<char>(MsgPackEncoding::kNil);
+				return true;
+			}
+
+			virtual bool WriteBeginObject() override
+			{
+				return BeginFrame(FrameKind::Object);
+			}
+
+			virtual bool WriteEndObject() override
+			{
+				return EndFrame(FrameKind::Object);
+			}
+
+			virtual bool WriteBeginObjectProperty(const std::string& propertyName) override
+			{
+				bool success = BeginEntry(FrameKind::Object);
+				if (success)
+				{
+					AppendString(propertyName);
+				}
+				return success;
+			}
+
+			virtual bool WriteEndObjectProperty() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Object;
+			}
+
+			virtual bool WriteBeginArray() override
+			{
+				return BeginFrame(FrameKind::Array);
+			}
+
+			virtual bool WriteEndArray() override
+			{
+				return EndFrame(FrameKind::Array);
+			}
+
+			virtual bool WriteBeginArrayElement() override
+			{
+				return BeginEntry(FrameKind::Array);
+			}
+
+			virtual bool WriteEndArrayElement() override
+			{
+				return !_frames.empty() && _frames.back().kind == FrameKind::Array;
+			}
+
+			virtual bool WriteInteger32Array(const int32_t* values, size_t count) override
+			{
+				return WriteNumberArray(values, count, [this](int32_t value) { AppendInteger(value); });
+			}
+
+			virtual bool WriteUnsignedInteger32Array(const uint32_t* values, size_t count) override
+			{
+				return WriteNumberArray(values, count, [this](uint32_t value) { AppendUnsignedInteger(value); });
+			}
+
+			virtual bool WriteFloatArray(const float* values, size_t count) override
+			{
+				return WriteTypedArray(values, count, MsgPackEncoding::kFloat32);
+			}
+
+			virtual bool WriteDoubleArray(const double* values, size_t count) override
+			{
+				return WriteTypedArray(values, count, MsgPackEncoding::kFloat64);
+			}
+
+			// Complete once every object and array has ended
+			const std::string& GetBuffer() const
+			{
+				return _buffer;
+			}
+
+			void Reserve(size_t capacity)
+			{
+				_buffer.reserve(capacity);
+				_content.reserve(capacity);
+			}
+
+			// Empties the buffer while keeping its capacity, to reuse the writer
+			void Clear()
+			{
+				_buffer.clear();
+				_frames.clear();
+				_headers.clear();
+			}
+
+			bool Export(std::ostream& outputStream)
+			{
+				outputStream.write(_buffer.data(), _buffer.size());
+				return _frames.empty();
+			}
+
+		private:
+			enum class FrameKind : uint8_t
+			{
+				Object,
+				Array
+			};
+
+			struct Frame
+			{
+				FrameKind kind;
+				uint32_t count;
+				size_t start;
+				size_t slot;
+			};
+
+			// Header to insert at an offset of the buffer. Headers are kept in the order frames
+			// begin, which is their order in the buffer, also for frames starting at the same offset.
+			struct Header
+			{
+				size_t offset;
+				uint32_t count;
+				FrameKind kind;
+			};
+
+			// Elements of a number array counted at once, without a call per element
+			template<typename number_t, typename append_t>
+			bool WriteNumberArray(const number_t* values, size_t count, const append_t& append)
+			{
+				BeginFrame(FrameKind::Array);
+				_frames.back().count = static_cast<uint32_t>(count);
+				_buffer.reserve(_buffer.size() + count * (1 + sizeof(number_t)));
+				for (size_t i = 0; i < count; ++i)
+				{
+					append(values[i]);
+				}
+				return EndFrame(FrameKind::Array);
+			}
+
+			// Elements of a single type byte and fixed size, encoded in place once the buffer has grown
+			template<typename value_t>
+			bool WriteTypedArray(const value_t* values, size_t count, uint8_t type)
+			{
+				BeginFrame(FrameKind::Array);
+				_frames.back().count = static_cast<uint32_t>(count);
+				const size_t start = _buffer.size();
+				_buffer.resize(start + count * (1 + sizeof(value_t)));
+				char* bytes = &_buffer[start];
+				for (size_t i = 0; i < count; ++i)
+				{
+					bytes[0] = static_cast<char>(type);
+					bytes += 1 + MsgPackEncoding::EncodeBigEndian(values[i], bytes + 1);
+				}
+				return EndFrame(FrameKind::Array);
+			}
+
+			void AppendInteger(int64_t value)
+			{
+				if (value >= 0)
+				{
+					AppendUnsignedInteger(static_cast<uint64_t>(value));
+				}
+				else if (value >= -32)
+				{
+					_buffer += static_cast<char>(value);
+				}
+				else if (value >= INT8_MIN)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kInt8, static_cast<int8_t>(value));
+				}
+				else if (value >= INT16_MIN)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kInt16, static_cast<int16_t>(value));
+				}
+				else if (value >= INT32_MIN)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kInt32, static_cast<int32_t>(value));
+				}
+				else
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kInt64, value);
+				}
+			}
+
+			void AppendUnsignedInteger(uint64_t value)
+			{
+				if (value <= MsgPackEncoding::kPositiveFixIntMax)
+				{
+					_buffer += static_cast<char>(value);
+				}
+				else if (value <= UINT8_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kUInt8, static_cast<uint8_t>(value));
+				}
+				else if (value <= UINT16_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kUInt16, static_cast<uint16_t>(value));
+				}
+				else if (value <= UINT32_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kUInt32, static_cast<uint32_t>(value));
+				}
+				else
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kUInt64, value);
+				}
+			}
+
+			void AppendString(std::string_view value)
+			{
+				const uint32_t size = static_cast<uint32_t>(value.size());
+				if (size <= MsgPackEncoding::kFixStrMaxSize)
+				{
+					_buffer += static_cast<char>(MsgPackEncoding::kFixStr | size);
+				}
+				else if (size <= UINT8_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kStr8, static_cast<uint8_t>(size));
+				}
+				else if (size <= UINT16_MAX)
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kStr16, static_cast<uint16_t>(size));
+				}
+				else
+				{
+					MsgPackEncoding::AppendTyped(_buffer, MsgPackEncoding::kStr32, size);
+				}
+				_buffer.append(value.data(), value.size());
+			}
+
+			bool BeginFrame(FrameKind kind)
+			{
+				_frames.push_back(Frame{ kind, 0, _buffer.size(), _headers.size() });
+				_headers.push_back(Header{ _buffer.size(), 0, kind });
+				return true;
+			}
+
+			bool EndFrame(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					const Frame frame = _frames.back();
+					_headers[frame.slot].count = frame.count;
+					_frames.pop_back();
+					if (_frames.empty())
+					{
+						InsertHeaders(frame.start);
+					}
+					success = true;
+				}
+				return success;
+			}
+
+			bool BeginEntry(FrameKind kind)
+			{
+				bool success = false;
+				if (!_frames.empty() && _frames.back().kind == kind)
+				{
+					++_frames.back().count;
+					success = true;
+				}
+				return success;
+			}
+
+			// Rebuilds the buffer from start with the headers inserted at their offsets. The content
+			// is moved to a second buffer that is kept, rather than copied to a new string.
+			void InsertHeaders(size_t start)
+			{
+				_content.assign(_buffer, start, std::string::npos);
+				_buffer.resize(start);
+				_buffer.reserve(start + _content.size() + _headers.size() * MsgPackEncoding::kMaxHeaderSize);
+
+				size_t copied = start;
+				for (const Header& header : _headers)
+				{
+					char bytes[MsgPackEncoding::kMaxHeaderSize];
+					_buffer.append(_content, copied - start, header.offset - copied);
+					_buffer.append(bytes, MsgPackEncoding::EncodeContainerHeader(header.kind == FrameKind::Object, header.count, bytes));
+					copied = header.offset;
+				}
+				_buffer.append(_content, copied - start, std::string::npos);
+				_headers.clear();
+			}
+
+			std::string _buffer;
+			std::string _content;
+			std::vector<Frame> _frames;
+			std::vector<Header> _headers;
+		};
+	}
+}
@@ -0,0 +1,123 @@
+#include "Serialization/Base64Encoding.h"
+
+#include <CppUnitTest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(Base64EncodingTest)
+			{
+			public:
+				TEST_METHOD(EncodeTestVectors)
+				{
+					/////////////
+					// Arrange
+					const std::vector<std::string> bytes = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+					const std::vector<std::string> expectedTexts = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+
+					/////////////
+					// Act
+					bool success = true;
+					std::vector<std::string> actualTexts;
+					std::vector<std::string> actualBytes;
+					for (const std::string& value : bytes)
+					{
+						std::string text;
+						std::string decoded;
+						Base64Encoding::Encode(value, text);
+						success &= Base64Encoding::Decode(text, decoded);
+						actualTexts.push_back(text);
+						actualBytes.push_back(decoded);
+					}
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expectedTexts == actualTexts, L"Unexpected encoded text");
+					Assert::IsTrue(bytes == actualBytes, L"Unexpected decoded bytes");
+				}
+
+				TEST_METHOD(ImplementationsAgree)
+				{
+					/////////////
+					// Arrange
+					// Long enough for whole SIMD blocks followed by every size of remainder
+					std::string bytes;
+					for (uint32_t i = 0; i < 1000; ++i)
+					{
+						bytes += static_cast<char>(i * 131 + (i >> 3));
+					}
+
+					/////////////
+					// Act
+					bool success = true;
+					bool agree = true;
+					for (Base64Encoding::Implementation implementation : { Base64Encoding::Implementation::Scalar, Base64Encoding::Implementation::Avx2 })
+					{
+						if (Base64Encoding::IsSupported(implementation))
+						{
+							for (size_t size = 0; size < 100; ++size)
+							{
+								const std::string_view value(bytes.data(), bytes.size() - size);
+								std::string expectedText;
+								std::string actualText;
+								std::string actualBytes;
+								Base64Encoding::Encode(value, expectedText, Base64Encoding::Implementation::Scalar);
+								Base64Encoding::Encode(value, actualText, implementation);
+								success &= Base64Encoding::Decode(actualText, actualBytes, implementation);
+								agree &= expectedText == actualText && value == actualBytes;
+							}
+						}
+					}
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(agree, L"Implementations give different results");
+				}
+
+				TEST_METHOD(DecodeInvalidText)
+				{
+					/////////////
+					// Arrange
+					const std::string valid(64, 'A');
+					std::vector<std::string> texts = { "Zg=", "Zg=a", "Z===", "=Zg=", "Zg==Zg==", "Zm9v!A==" };
+					// Invalid characters where SIMD decoding would see them
+					for (const char character : { '!', '-', '_', ' ', '\x80', '\xFF', '=' })
+					{
+						std::string text = valid;
+						text[5] = character;
+						texts.push_back(text);
+					}
+
+					/////////////
+					// Act
+					bool anySuccess = false;
+					for (Base64Encoding::Implementation implementation : { Base64Encoding::Implementation::Scalar, Base64Encoding::Implementation::Avx2 })
+					{
+						if (Base64Encoding::IsSupported(implementation))
+						{
+							for (const std::string& text : texts)
+							{
+								std::string bytes;
+								anySuccess |= Base64Encoding::Decode(text, bytes, implementation);
+							}
+						}
+					}
+
+					/////////////
+					// Assert
+					Assert::IsFalse(anySuccess, L"Unexpected operation success");
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,277 @@
+#include "Serialization/Reader/BinarySerializationReader.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/BinarySerializationWriter.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(BinarySerializationReaderTest)
+			{
+			public:
+				TEST_METHOD(ReadNumbers)
+				{
+					/////////////
+					// Arrange
+					BinarySerializationWriter writer;
+					writer.WriteBeginArray();
+					writer.WriteBeginArrayElement() && writer.WriteInteger32(std::numeric_limits<int32_t>::min()) && writer.WriteEndArrayElement();
+					writer.WriteBeginArrayElement() && writer.WriteUnsignedInteger32(std::numeric_limits<uint32_t>::max()) && writer.WriteEndArrayElement();
+					writer.WriteBeginArrayElement() && writer.WriteInteger64(-33445566778899) && writer.WriteEndArrayElement();
+					writer.WriteBeginArrayElement() && writer.WriteFloat(0.1f) && writer.WriteEndArrayElement();
+					writer.WriteBeginArrayElement() && writer.WriteDouble(-std::numeric_limits<double>::infinity()) && writer.WriteEndArrayElement();
+					writer.WriteBeginArrayElement() && writer.WriteBoolean(true) && writer.WriteEndArrayElement();
+					writer.WriteEndArray();
+
+					BinarySerializationReader reader;
+					reader.Import(writer.GetBuffer());
+
+					/////////////
+					// Act
+					bool success = true;
+					uint32_t index;
+					int32_t actualInt32;
+					uint32_t actualUnsignedInt32;
+					int64_t actualInt64;
+					float actualFloat;
+					double actualDouble;
+					bool actualBoolean;
+
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadInteger32(actualInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadUnsignedInteger32(actualUnsignedInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadInteger64(actualInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadFloat(actualFloat) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadDouble(actualDouble) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadBoolean(actualBoolean) && reader.ReadEndArrayElement();
+					success &= !reader.HasArrayElementRemaining();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(5u, index, L"Unexpected element index");
+					Assert::AreEqual(std::numeric_limits<int32_t>::min(), actualInt32, L"Unexpected read value");
+					Assert::AreEqual(std::numeric_limits<uint32_t>::max(), actualUnsignedInt32, L"Unexpected read value");
+					Assert::AreEqual(int64_t(-33445566778899), actualInt64, L"Unexpected read value");
+					Assert::AreEqual(0.1f, actualFloat, L"Unexpected read value");
+					Assert::AreEqual(-std::numeric_limits<double>::infinity(), actualDouble, L"Unexpected read value");
+					Assert::IsTrue(actualBoolean, L"Unexpected read value");
+				}
+
+				TEST_METHOD(SerializeNumberArrays)
+				{
+					/////////////
+					// Arrange
+					struct TestTelemetry
+					{
+						std::vector<int32_t> Ids;
+						std::vector<float> Samples;
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.Add<float>("float")
+						.Add<std::vector<int32_t>>("vector<int32>")
+						.Add<std::vector<float>>("vector<float>")
+						.BeginType<TestTelemetry>("TestTelemetry")
+							.RegisterMember(&TestTelemetry::Ids, "Ids")
+							.RegisterMember(&TestTelemetry::Samples, "Samples")
+						.EndType<TestTelemetry>()
+					.Build();
+
+					const Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<float, FloatSerializationStrategy>()
+						.LearnType<std::vector<int32_t>, VectorSerializationStrategy<std::vector<int32_t>>>()
+						.LearnType<std::vector<float>, VectorSerializationStrategy<std::vector<float>>>()
+						.LearnType<TestTelemetry, ObjectSerializationStrategy<TestTelemetry>>()
+						.SetFormat(SerializationFormat::Short)
+					.Build();
+
+					TestTelemetry expectedValue;
+					expectedValue.Ids = { 1, -2, 300 };
+					expectedValue.Samples = { 0.5f, -0.25f, 1e10f, 0.1f };
+
+					// Same bytes as the arrays written one element at a time
+					BinarySerializationWriter expectedWriter;
+					expectedWriter.WriteBeginObject();
+					expectedWriter.WriteBeginObjectProperty("Ids");
+					expectedWriter.ISerializationWriter::WriteInteger32Array(expectedValue.Ids.data(), expectedValue.Ids.size());
+					expectedWriter.WriteEndObjectProperty();
+					expectedWriter.WriteBeginObjectProperty("Samples");
+					expectedWriter.ISerializationWriter::WriteFloatArray(expectedValue.Samples.data(), expectedValue.Samples.size());
+					expectedWriter.WriteEndObjectProperty();
+					expectedWriter.WriteEndObject();
+
+					/////////////
+					// Act
+					bool success = true;
+					BinarySerializationWriter writer;
+					success &= serializer.Serialize(expectedValue, writer);
+
+					TestTelemetry actualValue;
+					actualValue.Ids = { 7 };
+					BinarySerializationReader reader;
+					success &= reader.Import(writer.GetBuffer());
+					success &= serializer.Deserialize(actualValue, reader);
+
+					/////////////
+					// Assert
+					const std::vector<int32_t> expectedIds = { 7, 1, -2, 300 };
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expectedWriter.GetBuffer() == writer.GetBuffer(), L"Unexpected written bytes");
+					Assert::IsTrue(expectedIds == actualValue.Ids, L"Unexpected appended elements");
+					Assert::IsTrue(expectedValue.Samples == actualValue.Samples, L"Unexpected read elements");
+				}
+
+				TEST_METHOD(SerializeObjectRoundTrip)
+				{
+					/////////////
+					// Arrange
+					struct TestInventory
+					{
+						std::string Owner;
+						std::vector<std::string> Items;
+						std::map<std::string, int32_t> Counts;
+
+						bool operator==(const TestInventory& other) const
+						{
+							return Owner == other.Owner && Items == other.Items && Counts == other.Counts;
+						}
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<std::string>("string")
+						.Add<int32_t>("int32")
+						.Add<std::vector<std::string>>("vector<string>")
+						.Add<std::map<std::string, int32_t>>("map<string,int32>")
+						.BeginType<TestInventory>("TestInventory")
+							.RegisterMember(&TestInventory::Owner, "Owner")
+							.RegisterMember(&TestInventory::Items, "Items")
+							.RegisterMember(&TestInventory::Counts, "Counts")
+						.EndType<TestInventory>()
+					.Build();
+
+					Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<std::string, StringSerializationStrategy>()
+						.LearnType<std::vector<std::string>, VectorSerializationStrategy<std::vector<std::string>>>()
+						.LearnType<std::map<std::string, int32_t>, MapSerializationStrategy<std::map<std::string, int32_t>>>()
+						.LearnType<TestInventory, ObjectSerializationStrategy<TestInventory>>()
+					.Build();
+
+					TestInventory expectedValue;
+					expectedValue.Owner = "Mr. Potato Head";
+					expectedValue.Items = { "Hat", "Shoes", "" };
+					expectedValue.Counts = { { "Eyes", 2 }, { "Mouth", 1 } };
+
+					/////////////
+					// Act
+					bool success = true;
+					std::vector<TestInventory> actualValues;
+					std::vector<size_t> actualSizes;
+					for (SerializationFormat format : { SerializationFormat::Descriptive, SerializationFormat::Short })
+					{
+						for (BinaryPropertyFormat propertyFormat : { BinaryPropertyFormat::Name, BinaryPropertyFormat::Index })
+						{
+							serializer.SetSerializationFormat(format);
+
+							BinarySerializationWriter writer(propertyFormat);
+							success &= serializer.Serialize(expectedValue, writer);
+
+							TestInventory actualValue;
+							BinarySerializationReader reader(propertyFormat);
+							success &= reader.Import(writer.GetBuffer());
+							success &= serializer.Deserialize(actualValue, reader);
+
+							actualValues.push_back(actualValue);
+							actualSizes.push_back(writer.GetBuffer().size());
+						}
+					}
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					for (const TestInventory& actualValue : actualValues)
+					{
+						Assert::IsTrue(expectedValue == actualValue, L"Deserialized value is unexpected");
+					}
+					Assert::IsTrue(actualSizes[1] < actualSizes[0] && actualSizes[3] < actualSizes[2], L"Property indexes unexpectedly larger than names");
+				}
+
+				TEST_METHOD(SerializeOptionalRoundTrip)
+				{
+					/////////////
+					// Arrange
+					struct TestToy
+					{
+						std::optional<int32_t> Owner;
+						std::optional<int32_t> PreviousOwner;
+						std::string Name;
+
+						bool operator==(const TestToy& other) const
+						{
+							return Owner == other.Owner && PreviousOwner == other.PreviousOwner && Name == other.Name;
+						}
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<std::string>("string")
+						.Add<int32_t>("int32")
+						.Add<std::optional<int32_t>>("optional<int32>")
+						.BeginType<TestToy>("TestToy")
+							.RegisterMember(&TestToy::Owner, "Owner")
+							.RegisterMember(&TestToy::PreviousOwner, "PreviousOwner")
+							.RegisterMember(&TestToy::Name, "Name")
+						.EndType<TestToy>()
+					.Build();
+
+					const Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<std::string, StringSerializationStrategy>()
+						.LearnType<std::optional<int32_t>, OptionalSerializationStrategy<std::optional<int32_t>>>()
+						.LearnType<TestToy, ObjectSerializationStrategy<TestToy>>()
+					.Build();
+
+					// Empty optional followed by a present one whose value starts like a null tag
+					TestToy expectedValue;
+					expectedValue.PreviousOwner = 0;
+					expectedValue.Name = "Woody";
+
+					/////////////
+					// Act
+					bool success = true;
+					BinarySerializationWriter writer;
+					success &= serializer.Serialize(expectedValue, writer);
+
+					TestToy actualValue;
+					actualValue.Owner = 7;
+					BinarySerializationReader reader;
+					success &= reader.Import(writer.GetBuffer());
+					success &= serializer.Deserialize(actualValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expectedValue == actualValue, L"Deserialized value is unexpected");
+				}
+			};
+		}
+	}
+}
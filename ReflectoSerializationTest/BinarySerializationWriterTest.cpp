@@ -0,0 +1,114 @@
+#include "Serialization/Writer/BinarySerializationWriter.h"
+
+#include <CppUnitTest.h>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(BinarySerializationWriterTest)
+			{
+			public:
+				TEST_METHOD(WriteObject)
+				{
+					/////////////
+					// Arrange
+					BinarySerializationWriter writer;
+					constexpr char kExpected[] = "\x02" "\x04" "Name" "\x02" "Ab" "\x06" "Values" "\x02" "\x01\x00\x00\x00" "\xFF\xFF\xFF\xFF";
+					const std::string expected(kExpected, sizeof(kExpected) - 1);
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginObject();
+					{
+						success &= writer.WriteBeginObjectProperty("Name");
+						success &= writer.WriteString("Ab");
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("Values");
+						success &= writer.WriteBeginArray();
+						{
+							success &= writer.WriteBeginArrayElement() && writer.WriteInteger32(1) && writer.WriteEndArrayElement();
+							success &= writer.WriteBeginArrayElement() && writer.WriteInteger32(-1) && writer.WriteEndArrayElement();
+						}
+						success &= writer.WriteEndArray();
+						success &= writer.WriteEndObjectProperty();
+					}
+					success &= writer.WriteEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+
+				TEST_METHOD(WritePropertyIndexes)
+				{
+					/////////////
+					// Arrange
+					BinarySerializationWriter writer(BinaryPropertyFormat::Index);
+					// Name follows its index the first time only
+					constexpr char kExpected[] = "\x02" "\x01" "\x00" "\x02" "Id" "\x07\x00\x00\x00" "\x01" "\x00" "\x08\x00\x00\x00";
+					const std::string expected(kExpected, sizeof(kExpected) - 1);
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginArray();
+					for (int32_t id : { 7, 8 })
+					{
+						success &= writer.WriteBeginArrayElement();
+						success &= writer.WriteBeginObject();
+						success &= writer.WriteBeginObjectProperty("Id") && writer.WriteInteger32(id) && writer.WriteEndObjectProperty();
+						success &= writer.WriteEndObject();
+						success &= writer.WriteEndArrayElement();
+					}
+					success &= writer.WriteEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+
+				TEST_METHOD(WriteEmptyNestedArrays)
+				{
+					/////////////
+					// Arrange
+					BinarySerializationWriter writer;
+					// An empty array starts at the same offset as the array following it
+					constexpr char kElements[] = "\x00" "\x01" "\x07\x00\x00\x00";
+					std::string expected = "\x14";
+					for (uint32_t i = 0; i < 10; ++i)
+					{
+						expected.append(kElements, sizeof(kElements) - 1);
+					}
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginArray();
+					for (uint32_t i = 0; i < 10; ++i)
+					{
+						success &= writer.WriteBeginArrayElement() && writer.WriteBeginArray() && writer.WriteEndArray() && writer.WriteEndArrayElement();
+						success &= writer.WriteBeginArrayElement() && writer.WriteBeginArray();
+						success &= writer.WriteBeginArrayElement() && writer.WriteInteger32(7) && writer.WriteEndArrayElement();
+						success &= writer.WriteEndArray() && writer.WriteEndArrayElement();
+					}
+					success &= writer.WriteEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,188 @@
+#include "Serialization/Reader/CborSerializationReader.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/CborSerializationWriter.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(CborSerializationReaderTest)
+			{
+			public:
+				TEST_METHOD(ReadNumbers)
+				{
+					/////////////
+					// Arrange
+					// [300, -5, 4294967295, 1.5 as half, 100000.0 as single, 0.1 as double]
+					constexpr char kInput[] = "\x86" "\x19\x01\x2C" "\x24" "\x1A\xFF\xFF\xFF\xFF" "\xF9\x3E\x00" "\xFA\x47\xC3\x50\x00" "\xFB\x3F\xB9\x99\x99\x99\x99\x99\x9A";
+					CborSerializationReader reader;
+					reader.Import(std::string_view(kInput, sizeof(kInput) - 1));
+
+					/////////////
+					// Act
+					bool success = true;
+					uint32_t index;
+					int32_t actualInt32;
+					int64_t actualInt64;
+					uint32_t actualUnsignedInt32;
+					double actualHalf;
+					float actualSingle;
+					double actualDouble;
+
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadInteger32(actualInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					const bool readNegativeAsUnsigned = reader.ReadUnsignedInteger32(actualUnsignedInt32);
+					success &= reader.ReadInteger64(actualInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					const bool readOverflowingInt32 = reader.ReadInteger32(actualInt32);
+					success &= reader.ReadUnsignedInteger32(actualUnsignedInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadDouble(actualHalf) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadFloat(actualSingle) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadDouble(actualDouble) && reader.ReadEndArrayElement();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsFalse(readNegativeAsUnsigned || readOverflowingInt32, L"Value unexpectedly read out of range");
+					Assert::AreEqual(300, actualInt32, L"Unexpected read value");
+					Assert::AreEqual(int64_t(-5), actualInt64, L"Unexpected read value");
+					Assert::AreEqual(4294967295u, actualUnsignedInt32, L"Unexpected read value");
+					Assert::AreEqual(1.5, actualHalf, L"Unexpected read value");
+					Assert::AreEqual(100000.0f, actualSingle, L"Unexpected read value");
+					Assert::AreEqual(0.1, actualDouble, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadObjectSkippingProperty)
+				{
+					/////////////
+					// Arrange
+					// {"Name": "Mr. Potato Head", "Parts": {"Eyes": [1, 2.5], "Bytes": h'0001'}}
+					CborSerializationWriter writer;
+					writer.WriteBeginObject();
+					writer.WriteBeginObjectProperty("Parts");
+					writer.WriteBeginObject();
+					writer.WriteBeginObjectProperty("Eyes");
+					writer.WriteBeginArray();
+					writer.WriteBeginArrayElement() && writer.WriteInteger32(1) && writer.WriteEndArrayElement();
+					writer.WriteBeginArrayElement() && writer.WriteDouble(2.5) && writer.WriteEndArrayElement();
+					writer.WriteEndArray();
+					writer.WriteEndObjectProperty();
+					writer.WriteBeginObjectProperty("Bytes") && writer.WriteBytes(std::string_view("\x00\x01", 2)) && writer.WriteEndObjectProperty();
+					writer.WriteEndObject();
+					writer.WriteEndObjectProperty();
+					writer.WriteBeginObjectProperty("Name") && writer.WriteString("Mr. Potato Head") && writer.WriteEndObjectProperty();
+					writer.WriteEndObject();
+
+					CborSerializationReader reader;
+					reader.Import(writer.GetBuffer());
+
+					/////////////
+					// Act
+					bool success = true;
+					std::vector<std::string> actualProperties;
+					std::string actualName;
+
+					success &= reader.ReadBeginObject();
+					while (reader.HasObjectPropertyRemaining())
+					{
+						std::string property;
+						success &= reader.ReadBeginObjectProperty(property);
+						if (property == "Name")
+						{
+							success &= reader.ReadString(actualName);
+						}
+						// Other properties are left unread
+						success &= reader.ReadEndObjectProperty();
+						actualProperties.push_back(property);
+					}
+					success &= reader.ReadEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(2u, static_cast<uint32_t>(actualProperties.size()), L"Unexpected property count");
+					Assert::AreEqual(std::string("Name"), actualProperties[0], L"Unexpected property order");
+					Assert::AreEqual(std::string("Mr. Potato Head"), actualName, L"Unexpected read value");
+				}
+
+				TEST_METHOD(SerializeObjectRoundTrip)
+				{
+					/////////////
+					// Arrange
+					struct TestInventory
+					{
+						std::string Owner;
+						std::vector<int32_t> Counts;
+						double Weight = 0;
+						bool Open = false;
+
+						bool operator==(const TestInventory& other) const
+						{
+							return Owner == other.Owner && Counts == other.Counts && Weight == other.Weight && Open == other.Open;
+						}
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<std::string>("string")
+						.Add<int32_t>("int32")
+						.Add<double>("double")
+						.Add<bool>("boolean")
+						.Add<std::vector<int32_t>>("vector<int32>")
+						.BeginType<TestInventory>("TestInventory")
+							.RegisterMember(&TestInventory::Owner, "Owner")
+							.RegisterMember(&TestInventory::Counts, "Counts")
+							.RegisterMember(&TestInventory::Weight, "Weight")
+							.RegisterMember(&TestInventory::Open, "Open")
+						.EndType<TestInventory>()
+					.Build();
+
+					const Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<std::string, StringSerializationStrategy>()
+						.LearnType<double, DoubleSerializationStrategy>()
+						.LearnType<bool, BooleanSerializationStrategy>()
+						.LearnType<std::vector<int32_t>, VectorSerializationStrategy<std::vector<int32_t>>>()
+						.LearnType<TestInventory, ObjectSerializationStrategy<TestInventory>>()
+					.Build();
+
+					TestInventory expectedValue;
+					expectedValue.Owner = "Mr. Potato Head";
+					expectedValue.Counts = { 0, -1, 1000, -100000 };
+					expectedValue.Weight = 0.3;
+					expectedValue.Open = true;
+
+					/////////////
+					// Act
+					bool success = true;
+					TestInventory actualValue;
+
+					CborSerializationWriter writer;
+					success &= serializer.Serialize(expectedValue, writer);
+
+					CborSerializationReader reader;
+					success &= reader.Import(writer.GetBuffer());
+					success &= serializer.Deserialize(actualValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expectedValue == actualValue, L"Deserialized value is unexpected");
+				}
+			};
+		}
+	}
+}
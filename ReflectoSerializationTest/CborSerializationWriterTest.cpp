@@ -0,0 +1,98 @@
+#include "Serialization/Writer/CborSerializationWriter.h"
+
+#include <CppUnitTest.h>
+#include <limits>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(CborSerializationWriterTest)
+			{
+			public:
+				TEST_METHOD(WriteShortestForms)
+				{
+					/////////////
+					// Arrange
+					// Examples of RFC 8949 appendix A
+					CborSerializationWriter writer;
+					constexpr char kExpected[] = "\x91"
+						"\x00" "\x17" "\x18\x18" "\x19\x03\xE8" "\x1A\x00\x0F\x42\x40" "\x20" "\x39\x03\xE7" "\x3B\x7F\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
+						"\xF9\x00\x00" "\xF9\x80\x00" "\xF9\x3E\x00" "\xFA\x47\xC3\x50\x00" "\xFB\x3F\xF1\x99\x99\x99\x99\x99\x9A" "\xF9\x00\x01" "\xF9\x7B\xFF" "\xF9\x7C\x00" "\xF9\x7E\x00";
+					const std::string expected(kExpected, sizeof(kExpected) - 1);
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginArray();
+					for (int64_t value : { int64_t(0), int64_t(23), int64_t(24), int64_t(1000), int64_t(1000000), int64_t(-1), int64_t(-1000), std::numeric_limits<int64_t>::min() })
+					{
+						success &= writer.WriteBeginArrayElement() && writer.WriteInteger64(value) && writer.WriteEndArrayElement();
+					}
+					for (double value : { 0.0, -0.0, 1.5, 100000.0, 1.1, 5.960464477539063e-8, 65504.0, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN() })
+					{
+						success &= writer.WriteBeginArrayElement() && writer.WriteDouble(value) && writer.WriteEndArrayElement();
+					}
+					success &= writer.WriteEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+
+				TEST_METHOD(WriteDeterministicObject)
+				{
+					/////////////
+					// Arrange
+					// Keys sort by their encoding, so shorter keys come first. Twenty four elements no
+					// longer fit the initial byte of the array head.
+					CborSerializationWriter writer;
+					CborSerializationWriter reorderedWriter;
+					constexpr char kExpectedBegin[] = "\xA4" "\x62" "Id" "\x07" "\x64" "Name" "\x66" "Potato" "\x64" "Tags" "\x98\x18";
+					constexpr char kExpectedEnd[] = "\x66" "Weight" "\xF9\x3E\x00";
+					const std::string expected = std::string(kExpectedBegin, sizeof(kExpectedBegin) - 1) + std::string(24, '\xF5') + std::string(kExpectedEnd, sizeof(kExpectedEnd) - 1);
+
+					auto writeTags = [](CborSerializationWriter& writer) {
+						bool success = writer.WriteBeginObjectProperty("Tags") && writer.WriteBeginArray();
+						for (uint32_t i = 0; i < 24; ++i)
+						{
+							success &= writer.WriteBeginArrayElement() && writer.WriteBoolean(true) && writer.WriteEndArrayElement();
+						}
+						return success && writer.WriteEndArray() && writer.WriteEndObjectProperty();
+					};
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginObject();
+					success &= writer.WriteBeginObjectProperty("Weight") && writer.WriteDouble(1.5) && writer.WriteEndObjectProperty();
+					success &= writer.WriteBeginObjectProperty("Name") && writer.WriteString("Potato") && writer.WriteEndObjectProperty();
+					success &= writer.WriteBeginObjectProperty("Id") && writer.WriteInteger32(7) && writer.WriteEndObjectProperty();
+					success &= writeTags(writer);
+					success &= writer.WriteEndObject();
+
+					// Same object in another order, with a name written twice
+					success &= reorderedWriter.WriteBeginObject();
+					success &= reorderedWriter.WriteBeginObjectProperty("Name") && reorderedWriter.WriteString("Carrot") && reorderedWriter.WriteEndObjectProperty();
+					success &= writeTags(reorderedWriter);
+					success &= reorderedWriter.WriteBeginObjectProperty("Id") && reorderedWriter.WriteInteger32(7) && reorderedWriter.WriteEndObjectProperty();
+					success &= reorderedWriter.WriteBeginObjectProperty("Weight") && reorderedWriter.WriteFloat(1.5f) && reorderedWriter.WriteEndObjectProperty();
+					success &= reorderedWriter.WriteBeginObjectProperty("Name") && reorderedWriter.WriteString("Potato") && reorderedWriter.WriteEndObjectProperty();
+					success &= reorderedWriter.WriteEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+					Assert::IsTrue(writer.GetBuffer() == reorderedWriter.GetBuffer(), L"Identical objects written differently");
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,192 @@
+#include "Serialization/Reader/JsonIndexedSerializationReader.h"
+#include "Serialization/Reader/JsonStructuralIndex.h"
+
+#include <CppUnitTest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(JsonIndexedSerializationReaderTest)
+			{
+			public:
+				TEST_METHOD(BuildIndexWithEachImplementation)
+				{
+					/////////////
+					// Arrange
+					// Backslash runs and strings straddle the 64 byte blocks
+					std::string input = R"({"Escapes": ")" + std::string(60, '\\') + R"(\"", "Numbers": [1, -2.5e3, true, null], )";
+					input += R"("Long": ")" + std::string(100, 'x') + R"(\\", "Nested": {"Key": "{[:,]}"}})";
+
+					const std::vector<JsonStructuralIndex::Implementation> implementations = {
+						JsonStructuralIndex::Implementation::Scalar,
+						JsonStructuralIndex::Implementation::Sse2,
+						JsonStructuralIndex::Implementation::Avx2
+					};
+
+					/////////////
+					// Act
+					std::vector<std::vector<uint32_t>> actualPositions;
+					for (JsonStructuralIndex::Implementation implementation : implementations)
+					{
+						if (JsonStructuralIndex::IsSupported(implementation))
+						{
+							JsonStructuralIndex index;
+							Assert::IsTrue(index.Build(input, implementation), L"Unexpected operation failure");
+							actualPositions.push_back(index.GetPositions());
+						}
+					}
+
+					/////////////
+					// Assert
+					const std::vector<uint32_t>& scalarPositions = actualPositions.front();
+					Assert::AreEqual(37u, static_cast<uint32_t>(scalarPositions.size()), L"Unexpected position count");
+					Assert::AreEqual(static_cast<uint32_t>(input.find(R"(", "Numbers")")), scalarPositions[5], L"Escaped quote unexpectedly indexed");
+					for (const std::vector<uint32_t>& positions : actualPositions)
+					{
+						Assert::IsTrue(scalarPositions == positions, L"Unexpected index difference between implementations");
+					}
+				}
+
+				TEST_METHOD(ReadEscapedString)
+				{
+					/////////////
+					// Arrange
+					JsonIndexedSerializationReader reader;
+					reader.Import(R"(["quote\" slash\\ tab\t eé clef𝄞", "plain"])");
+					const std::string expected = "quote\" slash\\ tab\t e\xC3\xA9 clef\xF0\x9D\x84\x9E";
+
+					/////////////
+					// Act
+					bool success = true;
+					uint32_t index;
+					std::string actualEscaped;
+					std::string actualPlain;
+
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadString(actualEscaped) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadString(actualPlain) && reader.ReadEndArrayElement();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actualEscaped, L"Unexpected read value");
+					Assert::AreEqual(std::string("plain"), actualPlain, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadObjectSkippingProperty)
+				{
+					/////////////
+					// Arrange
+					JsonIndexedSerializationReader reader;
+					reader.Import(R"({ "Name": "Mr. Potato Head", "Parts": { "Eyes": [1, {"Tricky": "]}"}], "Mouth": null }, "Age": 1 })");
+
+					const std::string expectedName = "Mr. Potato Head";
+					const int32_t expectedAge = 1;
+
+					/////////////
+					// Act
+					bool success = true;
+					std::vector<std::string> actualProperties;
+					std::string actualName;
+					int32_t actualAge = 0;
+
+					success &= reader.ReadBeginObject();
+					while (reader.HasObjectPropertyRemaining())
+					{
+						std::string property;
+						success &= reader.ReadBeginObjectProperty(property);
+						if (property == "Name")
+						{
+							success &= reader.ReadString(actualName);
+						}
+						else if (property == "Age")
+						{
+							success &= reader.ReadInteger32(actualAge);
+						}
+						// Other properties are left unread
+						success &= reader.ReadEndObjectProperty();
+						actualProperties.push_back(property);
+					}
+					success &= reader.ReadEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(3u, static_cast<uint32_t>(actualProperties.size()), L"Unexpected property count");
+					Assert::AreEqual(expectedName, actualName, L"Unexpected read value");
+					Assert::AreEqual(expectedAge, actualAge, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadMalformedArray)
+				{
+					/////////////
+					// Arrange
+					const std::vector<std::string> inputs = { "[1 x]", "[1;2]", "[1 2]", "[1,,2]", "[\"a\" \"b\"]", "[[1] [2]]", "[1" };
+
+					/////////////
+					// Act
+					bool anySuccess = false;
+					uint32_t maxCount = 0;
+					for (const std::string& input : inputs)
+					{
+						JsonIndexedSerializationReader reader;
+						reader.Import(input);
+
+						bool success = reader.ReadBeginArray();
+						uint32_t count = 0;
+						while (reader.HasArrayElementRemaining() && count < 10)
+						{
+							uint32_t index = 0;
+							success &= reader.ReadBeginArrayElement(index);
+							success &= reader.ReadEndArrayElement();
+							++count;
+						}
+						success &= reader.ReadEndArray();
+						anySuccess |= success;
+						maxCount = std::max(maxCount, count);
+					}
+
+					/////////////
+					// Assert
+					Assert::IsFalse(anySuccess, L"Unexpected operation success");
+					Assert::IsTrue(maxCount < 10, L"Reader did not stop on malformed input");
+				}
+
+				TEST_METHOD(ReadMalformedObject)
+				{
+					/////////////
+					// Arrange
+					JsonIndexedSerializationReader reader;
+					reader.Import(R"({ "A": 1 "B": 2 })");
+
+					/////////////
+					// Act
+					bool success = reader.ReadBeginObject();
+					uint32_t count = 0;
+					while (reader.HasObjectPropertyRemaining() && count < 10)
+					{
+						std::string property;
+						success &= reader.ReadBeginObjectProperty(property);
+						success &= reader.ReadEndObjectProperty();
+						++count;
+					}
+					success &= reader.ReadEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsFalse(success, L"Unexpected operation success");
+					Assert::IsTrue(count < 10, L"Reader did not stop on malformed input");
+				}
+			};
+		}
+	}
+}
@@ -88,6 +88,45 @@ namespace Reflecto
 					Assert::AreEqual(expected, actual, L"Unexpected read value");
 				}
 
+				TEST_METHOD(ReadNumbersOutOfRange)
+				{
+					/////////////
+					// Arrange
+					JsonSerializationReader reader;
+					reader.Import(std::stringstream(R"([-1, 4294967295, 1e39])"));
+
+					/////////////
+					// Act
+					bool success = true;
+					bool anyNarrowed = false;
+					int32_t actualInt32;
+					uint32_t actualUnsignedInt32;
+					int64_t actualInt64;
+					float actualFloat;
+					double actualDouble;
+					uint32_t index;
+
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadUnsignedInteger32(actualUnsignedInt32);
+					success &= reader.ReadInteger32(actualInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadInteger32(actualInt32);
+					success &= reader.ReadInteger64(actualInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadFloat(actualFloat);
+					success &= reader.ReadDouble(actualDouble) && reader.ReadEndArrayElement();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsFalse(anyNarrowed, L"Value unexpectedly narrowed");
+					Assert::AreEqual(-1, actualInt32, L"Unexpected read value");
+					Assert::AreEqual(int64_t(4294967295), actualInt64, L"Unexpected read value");
+					Assert::AreEqual(1e39, actualDouble, L"Unexpected read value");
+				}
+
 				TEST_METHOD(ReadFloat)
 				{
 					/////////////
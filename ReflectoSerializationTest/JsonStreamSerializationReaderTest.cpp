@@ -0,0 +1,307 @@
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+
+#include "Utils/IOExt.h"
+
+#include <CppUnitTest.h>
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(JsonStreamSerializationReaderTest)
+			{
+			public:
+				TEST_METHOD(ReadNumbers)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationReader reader;
+					reader.Import(R"([-2147483648, 4294967295, 33445566778899, 0.5, 1e+9999])");
+
+					/////////////
+					// Act
+					bool success = true;
+					int32_t actualInt32;
+					uint32_t actualUnsignedInt32;
+					int64_t actualInt64;
+					float actualFloat;
+					double actualDouble;
+					uint32_t index;
+
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadInteger32(actualInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadUnsignedInteger32(actualUnsignedInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					const bool readIntegerAsReal = reader.ReadDouble(actualDouble);
+					const bool readInt64AsInt32 = reader.ReadInteger32(actualInt32);
+					success &= reader.ReadInteger64(actualInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					const bool readRealAsInteger = reader.ReadInteger32(actualInt32);
+					success &= reader.ReadFloat(actualFloat) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadDouble(actualDouble) && reader.ReadEndArrayElement();
+					success &= !reader.HasArrayElementRemaining();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsFalse(readIntegerAsReal || readInt64AsInt32 || readRealAsInteger, L"Value unexpectedly read as another type");
+					Assert::AreEqual(std::numeric_limits<int32_t>::min(), actualInt32, L"Unexpected read value");
+					Assert::AreEqual(std::numeric_limits<uint32_t>::max(), actualUnsignedInt32, L"Unexpected read value");
+					Assert::AreEqual(int64_t(33445566778899), actualInt64, L"Unexpected read value");
+					Assert::AreEqual(0.5f, actualFloat, L"Unexpected read value");
+					Assert::AreEqual(std::numeric_limits<double>::infinity(), actualDouble, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadNumbersOutOfRange)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationReader reader;
+					reader.Import(R"([4294967296, -1, -9223372036854775808, 18446744073709551616, 1e39, 000000001234567890123])");
+
+					/////////////
+					// Act
+					bool success = true;
+					bool anyNarrowed = false;
+					int32_t actualInt32;
+					uint32_t actualUnsignedInt32;
+					int64_t actualInt64;
+					int64_t actualLongInt64;
+					float actualFloat;
+					double actualDouble;
+					double actualLargeDouble;
+					uint32_t index;
+
+					// Values that do not fit fail and are left to be read as a larger type
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadInteger32(actualInt32) || reader.ReadUnsignedInteger32(actualUnsignedInt32);
+					success &= reader.ReadInteger64(actualInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadUnsignedInteger32(actualUnsignedInt32);
+					success &= reader.ReadInteger32(actualInt32) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadInteger64(actualLongInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadInteger64(actualInt64);
+					success &= reader.ReadDouble(actualLargeDouble) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					anyNarrowed |= reader.ReadFloat(actualFloat);
+					success &= reader.ReadDouble(actualDouble) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadInteger64(actualInt64) && reader.ReadEndArrayElement();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsFalse(anyNarrowed, L"Value unexpectedly narrowed");
+					Assert::AreEqual(-1, actualInt32, L"Unexpected read value");
+					Assert::AreEqual(std::numeric_limits<int64_t>::min(), actualLongInt64, L"Unexpected read value");
+					Assert::AreEqual(18446744073709551616.0, actualLargeDouble, L"Unexpected read value");
+					Assert::AreEqual(1e39, actualDouble, L"Unexpected read value");
+					Assert::AreEqual(int64_t(1234567890123), actualInt64, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadEscapedString)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationReader reader;
+					reader.Import(R"("quote\" slash\\ tab\t eé clef𝄞")");
+					const std::string expected = "quote\" slash\\ tab\t e\xC3\xA9 clef\xF0\x9D\x84\x9E";
+
+					/////////////
+					// Act
+					std::string actual;
+					const bool success = reader.ReadString(actual);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actual, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadStringView)
+				{
+					/////////////
+					// Arrange
+					const std::string input = R"(["plain","escaped\n"])";
+					JsonStreamSerializationReader reader;
+					reader.Import(std::string_view(input));
+
+					/////////////
+					// Act
+					bool success = true;
+					uint32_t index;
+					std::string_view actualPlain;
+					std::string actualEscaped;
+
+					success &= reader.ReadBeginArray();
+					success &= reader.ReadBeginArrayElement(index) && reader.ReadStringView(actualPlain) && reader.ReadEndArrayElement();
+					success &= reader.ReadBeginArrayElement(index);
+					{
+						std::string_view escaped;
+						success &= reader.ReadStringView(escaped);
+						actualEscaped = std::string(escaped);
+					}
+					success &= reader.ReadEndArrayElement();
+					success &= reader.ReadEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(std::string("plain"), std::string(actualPlain), L"Unexpected read value");
+					Assert::IsTrue(actualPlain.data() == input.data() + 2, L"String without escape is unexpectedly copied");
+					Assert::AreEqual(std::string("escaped\n"), actualEscaped, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ImportFile)
+				{
+					/////////////
+					// Arrange
+					const std::string file = "JsonStreamSerializationReaderTest.json";
+					const std::string content = R"({"Name":"Mr. Potato Head"})";
+					IOExt::WriteToFile(file, std::vector<char>(content.begin(), content.end()));
+
+					/////////////
+					// Act
+					bool success = true;
+					std::string actualProperty;
+					std::string actualValue;
+					{
+						JsonStreamSerializationReader reader;
+						success &= reader.ImportFile(file);
+						success &= reader.ReadBeginObject();
+						success &= reader.ReadBeginObjectProperty(actualProperty);
+						success &= reader.ReadString(actualValue);
+						success &= reader.ReadEndObjectProperty();
+						success &= reader.ReadEndObject();
+					}
+					std::remove(file.c_str());
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(std::string("Name"), actualProperty, L"Unexpected property");
+					Assert::AreEqual(std::string("Mr. Potato Head"), actualValue, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadObjectSkippingProperty)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationReader reader;
+					reader.Import(R"({ "Name": "Mr. Potato Head", "Parts": { "Eyes": [1, {"Tricky": "]}"}], "Mouth": null }, "Age": 1 })");
+
+					const std::string expectedName = "Mr. Potato Head";
+					const int32_t expectedAge = 1;
+
+					/////////////
+					// Act
+					bool success = true;
+					std::vector<std::string> actualProperties;
+					std::string actualName;
+					int32_t actualAge = 0;
+
+					success &= reader.ReadBeginObject();
+					while (reader.HasObjectPropertyRemaining())
+					{
+						std::string property;
+						success &= reader.ReadBeginObjectProperty(property);
+						if (property == "Name")
+						{
+							success &= reader.ReadString(actualName);
+						}
+						else if (property == "Age")
+						{
+							success &= reader.ReadInteger32(actualAge);
+						}
+						// Other properties are left unread
+						success &= reader.ReadEndObjectProperty();
+						actualProperties.push_back(property);
+					}
+					success &= reader.ReadEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(3u, static_cast<uint32_t>(actualProperties.size()), L"Unexpected property count");
+					Assert::AreEqual(expectedName, actualName, L"Unexpected read value");
+					Assert::AreEqual(expectedAge, actualAge, L"Unexpected read value");
+				}
+
+				TEST_METHOD(ReadMalformedArray)
+				{
+					/////////////
+					// Arrange
+					const std::vector<std::string> inputs = { "[1 x]", "[1;2]", "[1 2]", "[1,,2]", "[1" };
+
+					/////////////
+					// Act
+					bool anySuccess = false;
+					uint32_t maxCount = 0;
+					for (const std::string& input : inputs)
+					{
+						JsonStreamSerializationReader reader;
+						reader.Import(input);
+
+						bool success = reader.ReadBeginArray();
+						uint32_t count = 0;
+						while (reader.HasArrayElementRemaining() && count < 10)
+						{
+							uint32_t index = 0;
+							int32_t value = 0;
+							success &= reader.ReadBeginArrayElement(index);
+							success &= reader.ReadInteger32(value);
+							success &= reader.ReadEndArrayElement();
+							++count;
+						}
+						success &= reader.ReadEndArray();
+						anySuccess |= success;
+						maxCount = std::max(maxCount, count);
+					}
+
+					/////////////
+					// Assert
+					Assert::IsFalse(anySuccess, L"Unexpected operation success");
+					Assert::IsTrue(maxCount < 10, L"Reader did not stop on malformed input");
+				}
+
+				TEST_METHOD(ReadMalformedObject)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationReader reader;
+					reader.Import(R"({ "A": 1 "B": 2 })");
+
+					/////////////
+					// Act
+					bool success = reader.ReadBeginObject();
+					uint32_t count = 0;
+					while (reader.HasObjectPropertyRemaining() && count < 10)
+					{
+						std::string property;
+						success &= reader.ReadBeginObjectProperty(property);
+						success &= reader.ReadEndObjectProperty();
+						++count;
+					}
+					success &= reader.ReadEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsFalse(success, L"Unexpected operation success");
+					Assert::AreEqual(1u, count, L"Reader did not stop on malformed input");
+				}
+			};
+		}
+	}
+}
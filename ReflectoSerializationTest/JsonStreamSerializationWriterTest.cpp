@@ -0,0 +1,339 @@
+#include "Serialization/Writer/JsonSerializationWriter.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+
+#include <CppUnitTest.h>
+#include <limits>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(JsonStreamSerializationWriterTest)
+			{
+			public:
+				TEST_METHOD(NoWrite)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter writer;
+					const std::string expected = R"()";
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					success &= writer.Export(stream);
+					std::string actual = stream.str();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actual, L"Unexpected written value");
+				}
+
+				TEST_METHOD(WriteNumbers)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter writer;
+					const std::string expected = R"([-2147483648,4294967295,-9223372036854775808,0.5,0.1,3.0,1e+21,null,-1e+9999])";
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					success &= writer.WriteBeginArray();
+					success &= writer.WriteBeginArrayElement() && writer.WriteInteger32(std::numeric_limits<int32_t>::min()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteUnsignedInteger32(std::numeric_limits<uint32_t>::max()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteInteger64(std::numeric_limits<int64_t>::min()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteFloat(0.5f) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteFloat(0.1f) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(3.0) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(1e21) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(std::numeric_limits<double>::quiet_NaN()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(-std::numeric_limits<double>::infinity()) && writer.WriteEndArrayElement();
+					success &= writer.WriteEndArray();
+					success &= writer.Export(stream);
+					std::string actual = stream.str();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actual, L"Unexpected written value");
+				}
+
+				TEST_METHOD(WriteShortestReals)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter writer;
+					const std::string expected = R"([0.1,0.3333333333333333,-0.0,5e-324,1.7976931348623157e+308,3.4028235e+38,1e-07])";
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					success &= writer.WriteBeginArray();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(0.1) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(1.0 / 3.0) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(-0.0) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(std::numeric_limits<double>::denorm_min()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDouble(std::numeric_limits<double>::max()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteFloat(std::numeric_limits<float>::max()) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteFloat(1e-7f) && writer.WriteEndArrayElement();
+					success &= writer.WriteEndArray();
+					success &= writer.Export(stream);
+					std::string actual = stream.str();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actual, L"Unexpected written value");
+				}
+
+				TEST_METHOD(WriteNumberArrays)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter writer;
+					const int32_t integers[] = { std::numeric_limits<int32_t>::min(), 0, 42 };
+					const float floats[] = { 0.5f, 0.1f, 3.0f, std::numeric_limits<float>::quiet_NaN() };
+					const std::string expected = R"({"Empty":[],"Floats":[0.5,0.1,3.0,null],"Integers":[-2147483648,0,42]})";
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginObject();
+					{
+						success &= writer.WriteBeginObjectProperty("Integers") && writer.WriteInteger32Array(integers, 3) && writer.WriteEndObjectProperty();
+						success &= writer.WriteBeginObjectProperty("Floats") && writer.WriteFloatArray(floats, 4) && writer.WriteEndObjectProperty();
+						success &= writer.WriteBeginObjectProperty("Empty") && writer.WriteDoubleArray(nullptr, 0) && writer.WriteEndObjectProperty();
+					}
+					success &= writer.WriteEndObject();
+					const std::string actual = writer.GetBuffer();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actual, L"Unexpected written value");
+				}
+
+				TEST_METHOD(WriteEscapedString)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter writer;
+					const std::string expected = R"("quote\" slash\\ tab\t bell\u0007 e\u00e9 clef\ud834\udd1e")";
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					success &= writer.WriteString("quote\" slash\\ tab\t bell\a e\xC3\xA9 clef\xF0\x9D\x84\x9E");
+					success &= writer.Export(stream);
+					std::string actual = stream.str();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, actual, L"Unexpected written value");
+				}
+
+				TEST_METHOD(WriteComplexObject)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter streamWriter;
+					JsonSerializationWriter documentWriter;
+					const std::string expected = R"({"Eyes":{"Color":"black","Size":5},"Legs":{"PossibleColors":["blue","orange","white"]},"Mouth":null,"Name":"Mr. Potato Head","Nose":"second"})";
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= WriteComplexObject(streamWriter);
+					success &= WriteComplexObject(documentWriter);
+
+					std::stringstream streamOutput;
+					std::stringstream documentOutput;
+					success &= streamWriter.Export(streamOutput);
+					success &= documentWriter.Export(documentOutput);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expected, streamOutput.str(), L"Unexpected written value");
+					Assert::AreEqual(documentOutput.str(), streamOutput.str(), L"Written value unexpectedly differs from document writer");
+				}
+
+				TEST_METHOD(WriteEntriesWithoutValue)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter writer;
+					const std::string expected = R"({"B":5,"C":[1,2]})";
+
+					/////////////
+					// Act
+					bool success = true;
+					bool anyEmptySuccess = false;
+					success &= writer.WriteBeginObject();
+					{
+						success &= writer.WriteBeginObjectProperty("A");
+						anyEmptySuccess |= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("B");
+						success &= writer.WriteInteger32(5);
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("\"Escaped\"");
+						anyEmptySuccess |= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("C");
+						{
+							success &= writer.WriteBeginArray();
+							for (int32_t value : { 1, 0, 2, 0 })
+							{
+								success &= writer.WriteBeginArrayElement();
+								if (value != 0)
+								{
+									success &= writer.WriteInteger32(value);
+									success &= writer.WriteEndArrayElement();
+								}
+								else
+								{
+									anyEmptySuccess |= writer.WriteEndArrayElement();
+								}
+							}
+							success &= writer.WriteEndArray();
+						}
+						success &= writer.WriteEndObjectProperty();
+					}
+					success &= writer.WriteEndObject();
+
+					std::stringstream stream;
+					success &= writer.Export(stream);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsFalse(anyEmptySuccess, L"Unexpected operation success");
+					Assert::AreEqual(expected, stream.str(), L"Unexpected written value");
+				}
+
+				TEST_METHOD(WriteNestedEscapedNames)
+				{
+					/////////////
+					// Arrange
+					JsonStreamSerializationWriter streamWriter;
+					JsonSerializationWriter documentWriter;
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= WriteNestedEscapedNames(streamWriter);
+					success &= WriteNestedEscapedNames(documentWriter);
+
+					std::stringstream streamOutput;
+					std::stringstream documentOutput;
+					success &= streamWriter.Export(streamOutput);
+					success &= documentWriter.Export(documentOutput);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(documentOutput.str(), streamOutput.str(), L"Written value unexpectedly differs from document writer");
+				}
+
+			private:
+				// Properties out of order, with a duplicated one, so that they need to be sorted
+				static bool WriteComplexObject(ISerializationWriter& writer)
+				{
+					bool success = true;
+					success &= writer.WriteBeginObject();
+					{
+						success &= writer.WriteBeginObjectProperty("Nose");
+						success &= writer.WriteString("first");
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("Name");
+						success &= writer.WriteString("Mr. Potato Head");
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("Eyes");
+						{
+							success &= writer.WriteBeginObject();
+							{
+								success &= writer.WriteBeginObjectProperty("Size");
+								success &= writer.WriteInteger32(5);
+								success &= writer.WriteEndObjectProperty();
+
+								success &= writer.WriteBeginObjectProperty("Color");
+								success &= writer.WriteString("black");
+								success &= writer.WriteEndObjectProperty();
+							}
+							success &= writer.WriteEndObject();
+						}
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("Mouth");
+						success &= writer.WriteNull();
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("Legs");
+						{
+							success &= writer.WriteBeginObject();
+							{
+								success &= writer.WriteBeginObjectProperty("PossibleColors");
+								{
+									success &= writer.WriteBeginArray();
+									for (const char* color : { "blue", "orange", "white" })
+									{
+										success &= writer.WriteBeginArrayElement();
+										success &= writer.WriteString(color);
+										success &= writer.WriteEndArrayElement();
+									}
+									success &= writer.WriteEndArray();
+								}
+								success &= writer.WriteEndObjectProperty();
+							}
+							success &= writer.WriteEndObject();
+						}
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty("Nose");
+						success &= writer.WriteString("second");
+						success &= writer.WriteEndObjectProperty();
+					}
+					success &= writer.WriteEndObject();
+					return success;
+				}
+
+				// Escaped names out of order, in an object and in each of the objects it holds
+				static bool WriteNestedEscapedNames(ISerializationWriter& writer)
+				{
+					bool success = true;
+					success &= writer.WriteBeginObject();
+					for (const std::string& outerName : { "\"b", "\"a" })
+					{
+						success &= writer.WriteBeginObjectProperty(outerName);
+						success &= writer.WriteBeginObject();
+						for (const std::string& innerName : { "\"z", "\"y" })
+						{
+							success &= writer.WriteBeginObjectProperty(innerName);
+							success &= writer.WriteString(outerName + innerName);
+							success &= writer.WriteEndObjectProperty();
+						}
+						success &= writer.WriteEndObject();
+						success &= writer.WriteEndObjectProperty();
+					}
+					success &= writer.WriteEndObject();
+					return success;
+				}
+			};
+		}
+	}
+}
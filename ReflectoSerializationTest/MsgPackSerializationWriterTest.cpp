@@ -0,0 +1,132 @@
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
+
+#include <CppUnitTest.h>
+#include <limits>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(MsgPackSerializationWriterTest)
+			{
+			public:
+				TEST_METHOD(WriteSmallestIntegers)
+				{
+					/////////////
+					// Arrange
+					MsgPackSerializationWriter writer;
+					constexpr char kExpected[] = "\x99" "\x00" "\x7F" "\xCC\x80" "\xE0" "\xD0\xDF" "\xCD\x01\x00" "\xD1\xFF\x7F" "\xCE\x00\x01\x00\x00" "\xD3\x80\x00\x00\x00\x00\x00\x00\x00";
+					const std::string expected(kExpected, sizeof(kExpected) - 1);
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginArray();
+					for (int64_t value : { int64_t(0), int64_t(127), int64_t(128), int64_t(-32), int64_t(-33), int64_t(256), int64_t(-129), int64_t(65536), std::numeric_limits<int64_t>::min() })
+					{
+						success &= writer.WriteBeginArrayElement() && writer.WriteInteger64(value) && writer.WriteEndArrayElement();
+					}
+					success &= writer.WriteEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+
+				TEST_METHOD(WriteNumberArrays)
+				{
+					/////////////
+					// Arrange
+					MsgPackSerializationWriter writer;
+					const int32_t integers[] = { 0, -33, 300 };
+					const double doubles[] = { 1.5 };
+					constexpr char kExpected[] = "\x92" "\x93" "\x00" "\xD0\xDF" "\xCD\x01\x2C" "\x91" "\xCB\x3F\xF8\x00\x00\x00\x00\x00\x00";
+					const std::string expected(kExpected, sizeof(kExpected) - 1);
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginArray();
+					success &= writer.WriteBeginArrayElement() && writer.WriteInteger32Array(integers, 3) && writer.WriteEndArrayElement();
+					success &= writer.WriteBeginArrayElement() && writer.WriteDoubleArray(doubles, 1) && writer.WriteEndArrayElement();
+					success &= writer.WriteEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+
+				TEST_METHOD(WriteHeaders)
+				{
+					/////////////
+					// Arrange
+					MsgPackSerializationWriter writer;
+					const std::string longName(32, 'n');
+					// Sixteen elements no longer fit a fixarray, thirty two characters no longer fit a fixstr
+					const std::string expected = std::string("\x82" "\xA5" "Flags" "\xDC\x00\x10", 10) + std::string(16, '\xC3') + "\xD9\x20" + longName + "\xC0";
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginObject();
+					{
+						success &= writer.WriteBeginObjectProperty("Flags");
+						success &= writer.WriteBeginArray();
+						for (uint32_t i = 0; i < 16; ++i)
+						{
+							success &= writer.WriteBeginArrayElement() && writer.WriteBoolean(true) && writer.WriteEndArrayElement();
+						}
+						success &= writer.WriteEndArray();
+						success &= writer.WriteEndObjectProperty();
+
+						success &= writer.WriteBeginObjectProperty(longName) && writer.WriteNull() && writer.WriteEndObjectProperty();
+					}
+					success &= writer.WriteEndObject();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+
+				TEST_METHOD(WriteEmptyNestedArrays)
+				{
+					/////////////
+					// Arrange
+					MsgPackSerializationWriter writer;
+					// An empty array starts at the same offset as the array following it
+					std::string expected("\xDC\x00\x14", 3);
+					for (uint32_t i = 0; i < 10; ++i)
+					{
+						expected += "\x90" "\x91" "\x07";
+					}
+
+					/////////////
+					// Act
+					bool success = true;
+					success &= writer.WriteBeginArray();
+					for (uint32_t i = 0; i < 10; ++i)
+					{
+						success &= writer.WriteBeginArrayElement() && writer.WriteBeginArray() && writer.WriteEndArray() && writer.WriteEndArrayElement();
+						success &= writer.WriteBeginArrayElement() && writer.WriteBeginArray();
+						success &= writer.WriteBeginArrayElement() && writer.WriteInteger32(7) && writer.WriteEndArrayElement();
+						success &= writer.WriteEndArray() && writer.WriteEndArrayElement();
+					}
+					success &= writer.WriteEndArray();
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::IsTrue(expected == writer.GetBuffer(), L"Unexpected written bytes");
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,142 @@
+#include "Common/Definitions.h"
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+#include "Serialization/SerializationPlan.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			TEST_CLASS(SerializationPlanTest)
+			{
+			public:
+				TEST_METHOD(CompileObjectPlan)
+				{
+					/////////////
+					// Arrange
+					struct TestPart
+					{
+						int32_t Count = 0;
+					};
+
+					struct TestToy
+					{
+						int32_t Id = 0;
+						std::string Name;
+						TestPart Part;
+						std::vector<int32_t> Sizes;
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.Add<std::string>("string")
+						.Add<std::vector<int32_t>>("vector<int32>")
+						.BeginType<TestPart>("TestPart")
+							.RegisterMember(&TestPart::Count, "Count")
+						.EndType<TestPart>()
+						.BeginType<TestToy>("TestToy")
+							.RegisterMember(&TestToy::Id, "Id")
+							.RegisterMember(&TestToy::Name, "Name")
+							.RegisterMember(&TestToy::Part, "Part")
+							.RegisterMember(&TestToy::Sizes, "Sizes")
+						.EndType<TestToy>()
+					.Build();
+
+					std::vector<StrategyKind> kinds(testTypeLibrary.GetDescriptors().size(), StrategyKind::Strategy);
+					kinds[testTypeLibrary.GetTypeIndex<int32_t>()] = StrategyKindOf<Int32SerializationStrategy>::value;
+					kinds[testTypeLibrary.GetTypeIndex<std::string>()] = StrategyKindOf<StringSerializationStrategy>::value;
+					kinds[testTypeLibrary.GetTypeIndex<std::vector<int32_t>>()] = StrategyKindOf<VectorSerializationStrategy<std::vector<int32_t>>>::value;
+					kinds[testTypeLibrary.GetTypeIndex<TestPart>()] = StrategyKindOf<ObjectSerializationStrategy<TestPart>>::value;
+					kinds[testTypeLibrary.GetTypeIndex<TestToy>()] = StrategyKindOf<ObjectSerializationStrategy<TestToy>>::value;
+
+					const TestToy toy;
+					auto getOffset = [&toy](const void* member) {
+						return static_cast<uint32_t>(static_cast<const byte*>(member) - reinterpret_cast<const byte*>(&toy));
+					};
+
+					/////////////
+					// Act
+					const SerializationPlans plans(testTypeLibrary, kinds, SerializationFormat::Short);
+					const uint32_t toyPlan = plans.FindPlan(testTypeLibrary.GetTypeIndex<TestToy>());
+					const uint32_t partPlan = plans.FindPlan(testTypeLibrary.GetTypeIndex<TestPart>());
+					const uint32_t stringPlan = plans.FindPlan(testTypeLibrary.GetTypeIndex<std::string>());
+
+					/////////////
+					// Assert
+					Assert::IsTrue(toyPlan != SerializationPlans::kNoPlan && partPlan != SerializationPlans::kNoPlan, L"Object type without a plan");
+					Assert::IsTrue(stringPlan == SerializationPlans::kNoPlan, L"Unexpected plan for a value type");
+
+					const std::vector<PlanInstruction>& instructions = plans.GetPlan(toyPlan).instructions;
+					Assert::AreEqual(4u, static_cast<uint32_t>(instructions.size()), L"Unexpected instruction count");
+					Assert::IsTrue(instructions[0].kind == StrategyKind::Integer32, L"Unexpected kind");
+					Assert::AreEqual(getOffset(&toy.Id), instructions[0].offset, L"Unexpected offset");
+					Assert::IsTrue(instructions[1].kind == StrategyKind::String, L"Unexpected kind");
+					Assert::AreEqual(getOffset(&toy.Name), instructions[1].offset, L"Unexpected offset");
+					Assert::IsTrue(instructions[2].kind == StrategyKind::Object, L"Unexpected kind");
+					Assert::AreEqual(getOffset(&toy.Part), instructions[2].offset, L"Unexpected offset");
+					Assert::AreEqual(partPlan, instructions[2].plan, L"Unexpected nested plan");
+					Assert::IsTrue(instructions[3].kind == StrategyKind::Strategy, L"Unexpected kind");
+					Assert::AreEqual(std::string("Sizes"), *instructions[3].name, L"Unexpected member name");
+				}
+
+				TEST_METHOD(DeserializeReorderedProperties)
+				{
+					/////////////
+					// Arrange
+					struct TestToy
+					{
+						int32_t Id = 0;
+						std::string Name;
+						bool Broken = false;
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.Add<std::string>("string")
+						.Add<bool>("boolean")
+						.BeginType<TestToy>("TestToy")
+							.RegisterMember(&TestToy::Id, "Id")
+							.RegisterMember(&TestToy::Name, "Name")
+							.RegisterMember(&TestToy::Broken, "Broken")
+						.EndType<TestToy>()
+					.Build();
+
+					const Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<std::string, StringSerializationStrategy>()
+						.LearnType<bool, BooleanSerializationStrategy>()
+						.LearnType<TestToy, ObjectSerializationStrategy<TestToy>>()
+						.SetFormat(SerializationFormat::Short)
+					.Build();
+
+					JsonStreamSerializationReader reader;
+					reader.Import(std::string_view(R"({"Broken":true,"Name":"Mr. Potato Head","Id":7})"));
+
+					/////////////
+					// Act
+					TestToy actualValue;
+					const bool success = serializer.Deserialize(actualValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(7, actualValue.Id, L"Unexpected read value");
+					Assert::AreEqual(std::string("Mr. Potato Head"), actualValue.Name, L"Unexpected read value");
+					Assert::IsTrue(actualValue.Broken, L"Unexpected read value");
+				}
+			};
+		}
+	}
+}
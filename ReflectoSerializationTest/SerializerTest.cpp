@@ -1,9 +1,18 @@
 #include "Type/TypeDescriptor.h"
+#include "Serialization/Reader/BinarySerializationReader.h"
+#include "Serialization/Reader/CborSerializationReader.h"
+#include "Serialization/Reader/JsonIndexedSerializationReader.h"
 #include "Serialization/Reader/JsonSerializationReader.h"
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+#include "Serialization/Reader/MsgPackSerializationReader.h"
 #include "Serialization/Serializer.h"
 #include "Serialization/SerializerFactory.h"
 #include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/BinarySerializationWriter.h"
+#include "Serialization/Writer/CborSerializationWriter.h"
 #include "Serialization/Writer/JsonSerializationWriter.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
 #include "Type/TypeDescriptorFactory.h"
 #include "Type/TypeLibrary.h"
 #include "Type/TypeLibraryFactory.h"
@@ -11,8 +20,11 @@
 
 #include <CppUnitTest.h>
 
+#include <any>
 #include <functional>
 #include <map>
+#include <optional>
+#include <sstream>
 #include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -297,6 +309,129 @@ namespace Reflecto
 					Assert::AreEqual(expectedValue, actualDeserializedValue, L"Deserialized value is unexpected");
 				}
 
+				TEST_METHOD(SerializeRange)
+				{
+					/////////////
+					// Arrange
+					Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<int32_t>("int32")
+					.Build();
+
+					Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.SetFormat(SerializationFormat::Short)
+					.Build();
+
+					const int32_t values[] = { 4, 8, 15, 16, 23, 42 };
+					const std::string expectedSerialized = "[15,16,23]";
+					const std::vector<int32_t> expectedDeserializedValue = { 4, 15, 16, 23 };
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					std::string actualSerialized;
+					std::vector<int32_t> actualDeserializedValue = { 4 };
+
+					JsonSerializationWriter writer;
+					success &= serializer.SerializeRange(values + 2, 3, writer);
+					success &= writer.Export(stream);
+
+					actualSerialized = stream.str();
+
+					JsonSerializationReader reader;
+					success &= reader.Import(stream);
+					success &= serializer.DeserializeRange(actualDeserializedValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Failure is unexpected!");
+					Assert::AreEqual(expectedSerialized, actualSerialized, L"Serialized value is unexpected!");
+					Assert::IsTrue(expectedDeserializedValue == actualDeserializedValue, L"Deserialized value is unexpected");
+				}
+
+				TEST_METHOD(SerializeBlob)
+				{
+					/////////////
+					// Arrange
+					Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<Blob>("blob")
+					.Build();
+
+					Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<Blob, BlobSerializationStrategy>()
+						.SetFormat(SerializationFormat::Short)
+					.Build();
+
+					const Blob value(std::string("foo\0bar", 7));
+					const std::string expectedSerialized = "\"Zm9vAGJhcg==\"";
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					std::string actualSerialized;
+					Blob actualDeserializedValue;
+
+					JsonSerializationWriter writer;
+					success &= serializer.Serialize(value, writer);
+					success &= writer.Export(stream);
+
+					actualSerialized = stream.str();
+
+					JsonSerializationReader reader;
+					success &= reader.Import(stream);
+					success &= serializer.Deserialize(actualDeserializedValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Failure is unexpected!");
+					Assert::AreEqual(expectedSerialized, actualSerialized, L"Serialized value is unexpected!");
+					Assert::IsTrue(value == actualDeserializedValue, L"Deserialized value is unexpected");
+				}
+
+				TEST_METHOD(SerializeBooleanVector)
+				{
+					/////////////
+					// Arrange
+					Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<bool>("bool")
+						.Add<std::vector<bool>>("vector<bool>")
+					.Build();
+
+					Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<bool, BooleanSerializationStrategy>()
+						.LearnType<std::vector<bool>, VectorSerializationStrategy<std::vector<bool>>>()
+						.SetFormat(SerializationFormat::Short)
+					.Build();
+
+					const std::vector<bool> expectedValue = { true, false, false, true };
+					const std::string expectedSerialized = "[true,false,false,true]";
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					std::string actualSerialized;
+					std::vector<bool> actualDeserializedValue;
+
+					JsonSerializationWriter writer;
+					success &= serializer.Serialize(expectedValue, writer);
+					success &= writer.Export(stream);
+
+					actualSerialized = stream.str();
+
+					JsonSerializationReader reader;
+					success &= reader.Import(stream);
+					success &= serializer.Deserialize(actualDeserializedValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Failure is unexpected!");
+					Assert::AreEqual(expectedSerialized, actualSerialized, L"Serialized value is unexpected!");
+					Assert::IsTrue(expectedValue == actualDeserializedValue, L"Deserialized value is unexpected");
+				}
+
 				TEST_METHOD(SerializeObject)
 				{
 					/////////////
@@ -602,6 +737,148 @@ namespace Reflecto
 					Assert::IsTrue(testPotatoHead == actualDeserializedValue, L"Deserialized value is unexpected");
 					Assert::AreEqual(expectedSerialized, actualSerialized, L"Serialized value is unexpected!");
 				}
+
+				TEST_METHOD(SerializeCustomStrategy)
+				{
+					/////////////
+					// Arrange
+					Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<int32_t>("int32")
+					.Build();
+
+					// Stored as tens, learned before the built-in strategy which is then ignored
+					Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t>(
+							[] (const Serializer&, const void* value, ISerializationWriter& writer) {
+								return writer.WriteInteger32(*static_cast<const int32_t*>(value) / 10);
+							},
+							[] (const Serializer&, void* value, ISerializationReader& reader) {
+								int32_t tens = 0;
+								const bool success = reader.ReadInteger32(tens);
+								*static_cast<int32_t*>(value) = tens * 10;
+								return success;
+							},
+							[] (std::any& any) -> void* {
+								return &std::any_cast<int32_t&>(any);
+							})
+						.LearnType<int32_t, Int32SerializationStrategy>()
+					.Build();
+
+					const int32_t expectedValue = 420;
+					const std::string expectedSerialized = StringExt::Format(std::string(R"({"type":"%s","value":%i})"), "int32", expectedValue / 10);
+
+					/////////////
+					// Act
+					bool success = true;
+					std::stringstream stream;
+					int32_t actualDeserializedValue;
+					std::string actualSerializedStr;
+
+					JsonSerializationWriter writer;
+					success &= serializer.Serialize(expectedValue, writer);
+					success &= writer.Export(stream);
+
+					actualSerializedStr = stream.str();
+
+					JsonSerializationReader reader;
+					success &= reader.Import(stream);
+					success &= serializer.Deserialize(actualDeserializedValue, reader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Failure is unexpected!");
+					Assert::AreEqual(expectedSerialized, actualSerializedStr, L"Serialized value is unexpected!");
+					Assert::AreEqual(expectedValue, actualDeserializedValue, L"Deserialized value is unexpected");
+				}
+
+				TEST_METHOD(SerializeOptionalObject)
+				{
+					/////////////
+					// Arrange
+					struct TestCouple
+					{
+						std::optional<TestPerson> Partner;
+						std::optional<TestPerson> PreviousPartner;
+						int32_t Years = 0;
+
+						bool operator==(const TestCouple& other) const
+						{
+							return Partner == other.Partner && PreviousPartner == other.PreviousPartner && Years == other.Years;
+						}
+					};
+
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<std::string>("string")
+						.Add<int32_t>("int32")
+						.BeginType<TestPerson>("TestPerson")
+							.RegisterMember(&TestPerson::Name, "Name")
+							.RegisterMember(&TestPerson::Age, "Age")
+						.EndType<TestPerson>()
+						.Add<std::optional<TestPerson>>("optional<TestPerson>")
+						.BeginType<TestCouple>("TestCouple")
+							.RegisterMember(&TestCouple::Partner, "Partner")
+							.RegisterMember(&TestCouple::PreviousPartner, "PreviousPartner")
+							.RegisterMember(&TestCouple::Years, "Years")
+						.EndType<TestCouple>()
+					.Build();
+
+					Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<std::string, StringSerializationStrategy>()
+						.LearnType<TestPerson, ObjectSerializationStrategy<TestPerson>>()
+						.LearnType<std::optional<TestPerson>, OptionalSerializationStrategy<std::optional<TestPerson>>>()
+						.LearnType<TestCouple, ObjectSerializationStrategy<TestCouple>>()
+					.Build();
+
+					// Empty optional followed by other members
+					TestCouple expectedValue;
+					expectedValue.Partner = TestPerson{ "Jessie", 30 };
+					expectedValue.Years = 12;
+
+					/////////////
+					// Act
+					bool success = true;
+					std::vector<TestCouple> actualValues;
+					for (SerializationFormat format : { SerializationFormat::Descriptive, SerializationFormat::Short })
+					{
+						serializer.SetSerializationFormat(format);
+						success &= RoundTrip<JsonSerializationWriter, JsonSerializationReader>(serializer, expectedValue, actualValues);
+						success &= RoundTrip<JsonStreamSerializationWriter, JsonStreamSerializationReader>(serializer, expectedValue, actualValues);
+						success &= RoundTrip<JsonStreamSerializationWriter, JsonIndexedSerializationReader>(serializer, expectedValue, actualValues);
+						success &= RoundTrip<MsgPackSerializationWriter, MsgPackSerializationReader>(serializer, expectedValue, actualValues);
+						success &= RoundTrip<CborSerializationWriter, CborSerializationReader>(serializer, expectedValue, actualValues);
+						success &= RoundTrip<BinarySerializationWriter, BinarySerializationReader>(serializer, expectedValue, actualValues);
+					}
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Failure is unexpected!");
+					Assert::AreEqual(size_t(12), actualValues.size(), L"Unexpected round trip count");
+					for (const TestCouple& actualValue : actualValues)
+					{
+						Assert::IsTrue(expectedValue == actualValue, L"Deserialized value is unexpected");
+					}
+				}
+
+			private:
+				template<typename writer_t, typename reader_t, typename value_t>
+				static bool RoundTrip(const Serializer& serializer, const value_t& value, std::vector<value_t>& actualValues)
+				{
+					bool success = true;
+					std::stringstream stream;
+
+					writer_t writer;
+					success &= serializer.Serialize(value, writer);
+					success &= writer.Export(stream);
+
+					value_t actualValue;
+					reader_t reader;
+					success &= reader.Import(stream);
+					success &= serializer.Deserialize(actualValue, reader);
+
+					actualValues.push_back(actualValue);
+					return success;
+				}
 			};
 		}
 	}
@@ -0,0 +1,176 @@
+#include "Serialization/Reader/JsonStreamSerializationReader.h"
+#include "Serialization/Reader/MsgPackSerializationReader.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/SerializerFactory.h"
+#include "Serialization/StaticSerializer.h"
+#include "Serialization/Strategy/SerializationStrategy.h"
+#include "Serialization/Writer/JsonStreamSerializationWriter.h"
+#include "Serialization/Writer/MsgPackSerializationWriter.h"
+#include "Type/TypeLibrary.h"
+#include "Type/TypeLibraryFactory.h"
+
+#include <CppUnitTest.h>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Reflecto
+{
+	namespace Serialization
+	{
+		namespace Test
+		{
+			struct TestStaticPart
+			{
+				std::string Name;
+				float Size = 0;
+			};
+
+			struct TestStaticToy
+			{
+				int32_t Id = 0;
+				uint32_t Stock = 0;
+				double Price = 0;
+				bool Broken = false;
+				TestStaticPart Head;
+				std::vector<TestStaticPart> Parts;
+				std::map<std::string, int32_t> Counts;
+				std::optional<std::string> Owner;
+				std::optional<std::string> PreviousOwner;
+			};
+		}
+
+		template<>
+		struct StaticTypeRegistration<Test::TestStaticPart>
+		{
+			static constexpr auto kMembers = std::make_tuple(
+				StaticMember("Name", &Test::TestStaticPart::Name),
+				StaticMember("Size", &Test::TestStaticPart::Size)
+			);
+		};
+
+		template<>
+		struct StaticTypeRegistration<Test::TestStaticToy>
+		{
+			static constexpr auto kMembers = std::make_tuple(
+				StaticMember("Id", &Test::TestStaticToy::Id),
+				StaticMember("Stock", &Test::TestStaticToy::Stock),
+				StaticMember("Price", &Test::TestStaticToy::Price),
+				StaticMember("Broken", &Test::TestStaticToy::Broken),
+				StaticMember("Head", &Test::TestStaticToy::Head),
+				StaticMember("Parts", &Test::TestStaticToy::Parts),
+				StaticMember("Counts", &Test::TestStaticToy::Counts),
+				StaticMember("Owner", &Test::TestStaticToy::Owner),
+				StaticMember("PreviousOwner", &Test::TestStaticToy::PreviousOwner)
+			);
+		};
+
+		namespace Test
+		{
+			TEST_CLASS(StaticSerializerTest)
+			{
+			public:
+				TEST_METHOD(SerializeLikeSerializer)
+				{
+					/////////////
+					// Arrange
+					const Reflection::TypeLibrary testTypeLibrary = Reflection::TypeLibraryFactory()
+						.Add<int32_t>("int32")
+						.Add<uint32_t>("uint32")
+						.Add<float>("float")
+						.Add<double>("double")
+						.Add<bool>("boolean")
+						.Add<std::string>("string")
+						.Add<std::optional<std::string>>("optional<string>")
+						.Add<std::map<std::string, int32_t>>("map<string,int32>")
+						.BeginType<TestStaticPart>("TestStaticPart")
+							.RegisterMember(&TestStaticPart::Name, "Name")
+							.RegisterMember(&TestStaticPart::Size, "Size")
+						.EndType<TestStaticPart>()
+						.Add<std::vector<TestStaticPart>>("vector<TestStaticPart>")
+						.BeginType<TestStaticToy>("TestStaticToy")
+							.RegisterMember(&TestStaticToy::Id, "Id")
+							.RegisterMember(&TestStaticToy::Stock, "Stock")
+							.RegisterMember(&TestStaticToy::Price, "Price")
+							.RegisterMember(&TestStaticToy::Broken, "Broken")
+							.RegisterMember(&TestStaticToy::Head, "Head")
+							.RegisterMember(&TestStaticToy::Parts, "Parts")
+							.RegisterMember(&TestStaticToy::Counts, "Counts")
+							.RegisterMember(&TestStaticToy::Owner, "Owner")
+							.RegisterMember(&TestStaticToy::PreviousOwner, "PreviousOwner")
+						.EndType<TestStaticToy>()
+					.Build();
+
+					const Serializer serializer = SerializerFactory(testTypeLibrary)
+						.LearnType<int32_t, Int32SerializationStrategy>()
+						.LearnType<uint32_t, UInt32SerializationStrategy>()
+						.LearnType<float, FloatSerializationStrategy>()
+						.LearnType<double, DoubleSerializationStrategy>()
+						.LearnType<bool, BooleanSerializationStrategy>()
+						.LearnType<std::string, StringSerializationStrategy>()
+						.LearnType<std::optional<std::string>, OptionalSerializationStrategy<std::optional<std::string>>>()
+						.LearnType<std::map<std::string, int32_t>, MapSerializationStrategy<std::map<std::string, int32_t>>>()
+						.LearnType<TestStaticPart, ObjectSerializationStrategy<TestStaticPart>>()
+						.LearnType<std::vector<TestStaticPart>, VectorSerializationStrategy<std::vector<TestStaticPart>>>()
+						.LearnType<TestStaticToy, ObjectSerializationStrategy<TestStaticToy>>()
+						.SetFormat(SerializationFormat::Short)
+					.Build();
+
+					TestStaticToy value;
+					value.Id = -7;
+					value.Stock = 4000000000u;
+					value.Price = 12.5;
+					value.Broken = true;
+					value.Head = TestStaticPart{ "Head", 2.5f };
+					value.Parts = { TestStaticPart{ "Eye", 0.5f }, TestStaticPart{ "Nose", 1.0f } };
+					value.Counts = { { "Arms", 2 }, { "Hats", 1 } };
+					value.Owner = "Andy";
+
+					/////////////
+					// Act
+					bool success = true;
+					JsonStreamSerializationWriter expectedJsonWriter;
+					JsonStreamSerializationWriter actualJsonWriter;
+					MsgPackSerializationWriter expectedMsgPackWriter;
+					MsgPackSerializationWriter actualMsgPackWriter;
+
+					success &= serializer.Serialize(value, expectedJsonWriter);
+					success &= StaticSerializer<TestStaticToy, JsonStreamSerializationWriter>::Serialize(value, actualJsonWriter);
+					success &= serializer.Serialize(value, expectedMsgPackWriter);
+					success &= StaticSerializer<TestStaticToy, MsgPackSerializationWriter>::Serialize(value, actualMsgPackWriter);
+
+					// Outputs must also be valid, which reading them back checks
+					JsonStreamSerializationReader jsonReader;
+					MsgPackSerializationReader msgPackReader;
+					TestStaticToy jsonValue;
+					TestStaticToy msgPackValue;
+					jsonValue.PreviousOwner = "Sid";
+					msgPackValue.PreviousOwner = "Sid";
+					success &= jsonReader.Import(actualJsonWriter.GetBuffer());
+					success &= serializer.Deserialize(jsonValue, jsonReader);
+					success &= msgPackReader.Import(actualMsgPackWriter.GetBuffer());
+					success &= serializer.Deserialize(msgPackValue, msgPackReader);
+
+					/////////////
+					// Assert
+					Assert::IsTrue(success, L"Unexpected operation failure");
+					Assert::AreEqual(expectedJsonWriter.GetBuffer(), actualJsonWriter.GetBuffer(), L"Unexpected JSON output");
+					Assert::IsTrue(expectedMsgPackWriter.GetBuffer() == actualMsgPackWriter.GetBuffer(), L"Unexpected MessagePack output");
+					for (const TestStaticToy* actual : { &jsonValue, &msgPackValue })
+					{
+						Assert::AreEqual(value.Id, actual->Id, L"Unexpected read value");
+						Assert::AreEqual(value.Stock, actual->Stock, L"Unexpected read value");
+						Assert::AreEqual(value.Head.Name, actual->Head.Name, L"Unexpected read value");
+						Assert::AreEqual(static_cast<uint32_t>(value.Parts.size()), static_cast<uint32_t>(actual->Parts.size()), L"Unexpected read value");
+						Assert::IsTrue(value.Counts == actual->Counts, L"Unexpected read value");
+						Assert::IsTrue(value.Owner == actual->Owner, L"Unexpected read value");
+						Assert::IsFalse(actual->PreviousOwner.has_value(), L"Unexpected read value");
+					}
+				}
+			};
+		}
+	}
+}